@@ -0,0 +1,210 @@
+/**
+ * @file checkpoint.cpp
+ * @brief Implementation of the Checkpoint struct
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+#include "checkpoint.hpp"
+
+// First bytes of a checkpoint file, with the version of the format
+#define CHECKPOINT_MAGIC "MEWCCKP2"
+
+// Parameters of the 64-bit FNV-1a hash of the fingerprints
+#define FNV_OFFSET 14695981039346656037ull
+#define FNV_PRIME 1099511628211ull
+
+/**
+ * @brief Write a value to a binary stream
+ *
+ * @param output The stream
+ * @param value The value
+ */
+template <typename T>
+void writeValue(std::ofstream &output, const T &value)
+{
+    output.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+/**
+ * @brief Write a vector to a binary stream, preceded by its size
+ *
+ * @param output The stream
+ * @param values The vector
+ */
+template <typename T>
+void writeVector(std::ofstream &output, const std::vector<T> &values)
+{
+    writeValue<long unsigned int>(output, values.size());
+    output.write(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(T));
+}
+
+/**
+ * @brief Read a value from a binary stream
+ *
+ * @param input The stream
+ * @return T The value
+ * @throws std::runtime_error If the stream ends before the value
+ */
+template <typename T>
+T readValue(std::ifstream &input)
+{
+    T value;
+    if (!input.read(reinterpret_cast<char *>(&value), sizeof(T)))
+        throw std::runtime_error("Truncated checkpoint file");
+    return value;
+}
+
+/**
+ * @brief Read a vector written by writeVector() from a binary stream
+ *
+ * @param input The stream
+ * @return std::vector<T> The vector
+ * @throws std::runtime_error If the stream ends before the vector
+ */
+template <typename T>
+std::vector<T> readVector(std::ifstream &input)
+{
+    long unsigned int size = readValue<long unsigned int>(input);
+    std::vector<T> values;
+    // Read by chunks, so that a corrupted size fails on the end of the file
+    // instead of allocating it all at once
+    while (values.size() < size)
+    {
+        long unsigned int chunk = std::min<long unsigned int>(size - values.size(), 1 << 16);
+        long unsigned int start = values.size();
+        values.resize(start + chunk);
+        if (!input.read(reinterpret_cast<char *>(values.data() + start), chunk * sizeof(T)))
+            throw std::runtime_error("Truncated checkpoint file");
+    }
+    return values;
+}
+
+/**
+ * @brief Save the checkpoint to a file
+ *
+ * @param path The path of the file
+ * @throws std::runtime_error If the file can't be written
+ */
+void Checkpoint::save(const std::string &path) const
+{
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream output(temporary, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!output.is_open())
+            throw std::runtime_error("Could not open checkpoint file");
+
+        output.write(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC) - 1);
+        writeValue(output, vertices);
+        writeValue(output, edges);
+        writeValue(output, fingerprint);
+        writeValue<unsigned int>(output, pivot);
+        writeValue<unsigned int>(output, engine);
+        writeValue(output, next);
+        writeValue(output, nodes);
+        writeVector(output, clique);
+        writeValue(output, weight);
+        writeValue(output, words);
+        writeVector(output, R);
+        writeVector(output, sets);
+        writeVector(output, weights);
+
+        if (!output.flush())
+            throw std::runtime_error("Could not write checkpoint file");
+    }
+    if (std::rename(temporary.c_str(), path.c_str()) != 0)
+        throw std::runtime_error("Could not write checkpoint file");
+}
+
+/**
+ * @brief Load a checkpoint from a file
+ *
+ * @param path The path of the file
+ * @return Checkpoint The checkpoint
+ * @throws std::runtime_error If the file can't be read or is not a checkpoint
+ */
+Checkpoint Checkpoint::load(const std::string &path)
+{
+    std::ifstream input(path, std::ios::in | std::ios::binary);
+    if (!input.is_open())
+        throw std::runtime_error("Could not open checkpoint file");
+
+    std::string magic(sizeof(CHECKPOINT_MAGIC) - 1, '\0');
+    if (!input.read(&magic[0], magic.size()) || magic != CHECKPOINT_MAGIC)
+        throw std::runtime_error("Invalid checkpoint file");
+
+    Checkpoint checkpoint;
+    checkpoint.vertices = readValue<unsigned int>(input);
+    checkpoint.edges = readValue<long unsigned int>(input);
+    checkpoint.fingerprint = readValue<uint64_t>(input);
+    checkpoint.pivot = static_cast<Pivot>(readValue<unsigned int>(input));
+    checkpoint.engine = static_cast<Engine>(readValue<unsigned int>(input));
+    checkpoint.next = readValue<unsigned int>(input);
+    checkpoint.nodes = readValue<long unsigned int>(input);
+    checkpoint.clique = readVector<unsigned int>(input);
+    checkpoint.weight = readValue<long unsigned int>(input);
+    checkpoint.words = readValue<unsigned int>(input);
+    checkpoint.R = readVector<unsigned int>(input);
+    checkpoint.sets = readVector<uint64_t>(input);
+    checkpoint.weights = readVector<long unsigned int>(input);
+
+    // One frame per vertex of R, each with three bitsets and a weight
+    if (checkpoint.sets.size() != 3 * checkpoint.R.size() * checkpoint.words ||
+        checkpoint.weights.size() != checkpoint.R.size())
+        throw std::runtime_error("Invalid checkpoint file");
+    return checkpoint;
+}
+
+/**
+ * @brief Hash a value into a 64-bit FNV-1a hash
+ *
+ * @param hash The hash so far
+ * @param value The value
+ */
+void hashValue(uint64_t &hash, uint64_t value)
+{
+    for (unsigned int i = 0; i < sizeof(value); i++)
+    {
+        hash ^= (value >> (8 * i)) & 0xff;
+        hash *= FNV_PRIME;
+    }
+}
+
+/**
+ * @brief Get the fingerprint of the graph of a search
+ *
+ * The fingerprint is a hash of the ids of the vertices of the view and of the
+ * (u, v, w) triples of its edges, sorted by the ids, so two graphs with the
+ * same size but different edges or weights get different fingerprints.
+ *
+ * @param view The subgraph view searched
+ * @return uint64_t The fingerprint
+ */
+uint64_t Checkpoint::fingerprintOf(const SubgraphView &view) // Time complexity: O(n + m)
+{
+    const FrozenGraph &g = view.graph();
+    uint64_t hash = FNV_OFFSET;
+    for (auto u : view.vertices())
+    {
+        hashValue(hash, g.id(u));
+
+        // The neighbors are sorted by index, that is by id
+        auto neighbors = g.neighbors(u);
+        auto weights = g.weights(u);
+        for (long unsigned int i = 0; i < neighbors.size(); i++)
+        {
+            if (neighbors[i] <= u || !view.hasVertex(neighbors[i]))
+                continue;
+            hashValue(hash, g.id(u));
+            hashValue(hash, g.id(neighbors[i]));
+            hashValue(hash, weights[i]);
+        }
+    }
+    return hash;
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+/**
+ * @file checkpoint.hpp
+ * @brief Declaration of the Checkpoint struct
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "mewc.hpp"
+
+#ifndef CHECKPOINT_HPP
+#define CHECKPOINT_HPP
+
+/**
+ * @brief The state of an exact search, saved to resume it later
+ *
+ * The maximal cliques are enumerated one subproblem per vertex in a degeneracy
+ * order, which is deterministic, so the state is the position of the current
+ * subproblem in the order, the explicit stack of the bit-parallel search in
+ * that subproblem (empty when the subproblem starts from scratch) and the
+ * heaviest clique found so far.
+ *
+ * A fingerprint of the graph and the options that change the order of the
+ * search are saved along with it, so that a search is only resumed on the same
+ * problem. The file is written to a temporary file first and then renamed, so
+ * that a preemption while saving keeps the previous checkpoint.
+ */
+struct Checkpoint
+{
+    // The problem
+    unsigned int vertices = 0;
+    long unsigned int edges = 0;
+    uint64_t fingerprint = 0; // hash of the vertices and the weighted edges
+    Pivot pivot = Pivot::Tomita;
+    Engine engine = Engine::BitParallel; // the engine used, not the one asked for
+
+    // The progress of the search
+    unsigned int next = 0;                // position of the current subproblem
+    long unsigned int nodes = 0;          // nodes explored so far
+    std::vector<unsigned int> clique;     // heaviest clique found so far
+    long unsigned int weight = 0;         // weight of the heaviest clique
+
+    // The explicit stack of the current subproblem, one frame per vertex of R
+    // from the first one: P, X and the vertices left to branch on, as bitsets of
+    // words words, and the weight of R
+    unsigned int words = 0;
+    std::vector<unsigned int> R;
+    std::vector<uint64_t> sets;
+    std::vector<long unsigned int> weights;
+
+    void save(const std::string &path) const;
+    static Checkpoint load(const std::string &path);
+    static uint64_t fingerprintOf(const SubgraphView &view);
+};
+
+#endif // CHECKPOINT_HPP
@@ -0,0 +1,138 @@
+/**
+ * @file components_mewc.cpp
+ * @brief This file contains the decomposition of the MEWC problem into the
+ * connected components of the graph
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <numeric>
+#include <vector>
+
+#include "../model/task_pool.hpp"
+#include "mewc.hpp"
+#include "search_monitor.hpp"
+
+/**
+ * @brief Run an algorithm on each connected component of a frozen graph
+ *
+ * A clique always lies in a single connected component, so the heaviest clique
+ * of the graph is the heaviest of the cliques found in its components. Each
+ * component is frozen as a graph of its own, so that the algorithms only work
+ * on its vertices (the bit matrix of the exact algorithm, for instance, is
+ * O(k^2) instead of O(n^2)).
+ *
+ * The components are solved from the heaviest to the lightest on a pool of
+ * options.threads workers. The total weight of the edges of a component is an
+ * upper bound of the weight of its cliques, so a component whose total weight
+ * can't beat the heaviest clique found so far is skipped.
+ *
+ * The exact algorithms share a single SearchMonitor between the components, so
+ * the time limit is a budget for the whole graph: once it is reached, the
+ * running searches stop and the components left are skipped, and a single
+ * report is printed at the end.
+ *
+ * When the components are solved in parallel, the algorithm runs on a single
+ * thread for each of them, except the heaviest one which gets the threads left
+ * when there are fewer components with an edge than threads. The lone vertices
+ * are not solved, since a component with an edge always beats them. A thread
+ * that runs out of components doesn't help the ones still running, so a few
+ * heavy components may be solved faster as a whole graph with all the
+ * threads. A graph with a single component to solve is passed
+ * as is to the algorithm, as is any graph when a checkpoint is saved or resumed
+ * since a checkpoint is made for a whole graph.
+ *
+ * @param graph The frozen graph to run the algorithm on
+ * @param algorithm The algorithm to run
+ * @param options The options of the algorithm
+ * @return Clique The heaviest clique found by the algorithm in the components
+ * @throws std::invalid_argument If the algorithm is invalid
+ */
+Clique componentsMEWC(const FrozenGraph &graph, const Algorithm &algorithm, const MEWCOptions &options)
+{
+    if (!options.checkpoint.empty() || !options.resume.empty())
+        return runMEWC(graph, algorithm, options);
+
+    std::vector<std::vector<unsigned int>> components = graph.components(); // O(n + m)
+
+    // Upper bound of the weight of the cliques of each component
+    std::vector<long unsigned int> bounds(components.size(), 0);
+    for (long unsigned int c = 0; c < components.size(); c++)
+    {
+        for (auto v : components[c])
+            for (auto weight : graph.weights(v))
+                bounds[c] += weight;
+        bounds[c] /= 2;
+    }
+
+    std::vector<long unsigned int> order(components.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&bounds](long unsigned int a, long unsigned int b)
+                     { return bounds[a] > bounds[b]; });
+
+    // Only the heaviest component can hold an edge, the others are isolated
+    // vertices which can't beat a clique of it
+    if (order.size() <= 1 || bounds[order[1]] == 0)
+        return runMEWC(graph, algorithm, options);
+
+    // Only the components with an edge are solved
+    long unsigned int solvable = 0;
+    while (solvable < order.size() && bounds[order[solvable]] > 0)
+        solvable++;
+    order.resize(solvable);
+
+    std::atomic<long int> best_weight(-1);
+    std::mutex best_mutex;
+    Clique best;
+
+    // The heuristics don't follow the time limit, so they don't report either
+    bool exact = algorithm == Algorithm::Exact || algorithm == Algorithm::ExactBnB;
+    SearchMonitor monitor(getAlgorithmName(algorithm), exact ? options.timeLimit : 0, exact && options.progress);
+    monitor.setShared(true);
+
+    MEWCOptions component_options = options;
+    component_options.threads = 1;
+    component_options.monitor = &monitor;
+
+    // The owner of a deque pops its newest task first, so the components are
+    // pushed from the lightest to the heaviest
+    unsigned int workers = std::max(1u, std::min<unsigned int>(options.threads, order.size()));
+    unsigned int spare = options.threads > workers ? options.threads - workers : 0;
+    TaskPool<long unsigned int> pool(workers);
+    for (long unsigned int i = order.size(); i-- > 0;)
+        pool.push(i % workers, order[i]);
+
+    pool.run([&](unsigned int, long unsigned int &c)
+             {
+                 monitor.check();
+                 if (monitor.stopped() || static_cast<long int>(bounds[c]) <= best_weight.load())
+                     return;
+
+                 // The heaviest component gets the threads no other one uses
+                 MEWCOptions own_options = component_options;
+                 if (c == order.front())
+                     own_options.threads += spare;
+
+                 FrozenGraph component(graph, components[c]);
+                 Clique clique = runMEWC(component, algorithm, own_options);
+                 long int weight = component.weight(component.indices(clique));
+
+                 std::lock_guard<std::mutex> lock(best_mutex);
+                 if (weight > best_weight.load())
+                 {
+                     best = clique;
+                     best_weight.store(weight);
+                 } });
+
+    // Once every component is solved, the heaviest clique is the maximum one
+    monitor.setShared(false);
+    if (!monitor.stopped())
+        monitor.setBound(best_weight.load());
+    monitor.report();
+
+    return best;
+}
@@ -0,0 +1,221 @@
+/**
+ * @file constructive_engine.cpp
+ * @brief Implementation of the ConstructiveEngine class and of the orders of
+ * the construction
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <algorithm>
+
+#include "constructive_engine.hpp"
+
+/**
+ * @brief Returns the vertices of a subgraph view sorted by degree
+ *
+ * @param view The subgraph view
+ * @return std::vector<unsigned int> The indices of the vertices sorted by
+ * their degree in the view
+ */
+std::vector<unsigned int> sortVerticesDegree(const SubgraphView &view) // O(m + nlogn)
+{
+    std::vector<unsigned int> degrees(view.graph().size(), 0);
+    std::vector<unsigned int> sortedVertices = view.vertices();
+    for (auto v : sortedVertices)
+        degrees[v] = view.degree(v);
+
+    std::stable_sort(sortedVertices.begin(), sortedVertices.end(), [&degrees](unsigned int a, unsigned int b)
+                     { return degrees[a] > degrees[b]; });
+
+    return sortedVertices;
+}
+
+/**
+ * @brief Returns the vertices of a subgraph view sorted by the sum of their
+ * edges weights
+ *
+ * @param view The subgraph view
+ * @return std::vector<unsigned int> The indices of the vertices sorted by the
+ * sum of their edges weights in the view
+ */
+std::vector<unsigned int> sortVerticesSumWeight(const SubgraphView &view) // O(m + nlogn)
+{
+    std::vector<long unsigned int> weights(view.graph().size(), 0);
+    std::vector<unsigned int> sortedVertices = view.vertices();
+    for (auto v : sortedVertices)
+        weights[v] = view.weightedDegree(v);
+
+    std::stable_sort(sortedVertices.begin(), sortedVertices.end(), [&weights](unsigned int a, unsigned int b)
+                     { return weights[a] > weights[b]; });
+
+    return sortedVertices;
+}
+
+/**
+ * @brief Construct a new ConstructiveEngine:: ConstructiveEngine object
+ *
+ * The buffers are sized for the largest possible P and clique. The order and
+ * the bit matrix are kept by reference, so that they are built once for all
+ * the engines of a view.
+ *
+ * The time complexity of this constructor is O(n / 64) on dense graphs and
+ * O(n) otherwise.
+ *
+ * @param view The subgraph view
+ * @param order The vertices of the view sorted by the criteria of the
+ * construction, the best one first
+ * @param adjacency The bit matrix of the graph given by adjacency(), empty on
+ * sparse graphs
+ */
+ConstructiveEngine::ConstructiveEngine(
+    const SubgraphView &view,
+    const std::vector<unsigned int> &order,
+    const std::optional<BitAdjacency> &adjacency)
+    : _graph(&view.graph()),
+      _order(order),
+      _vertexSet(view.vertexSet()),
+      _adjacency(adjacency.has_value() ? &adjacency.value() : nullptr),
+      _weight(0)
+{
+    if (_adjacency)
+        _P.resize(_vertexSet.size());
+    else
+    {
+        _vertices = view.vertices();
+        _sparseP.reserve(_vertices.size());
+    }
+    _clique.reserve(view.size());
+}
+
+/**
+ * @brief Destroy the ConstructiveEngine:: ConstructiveEngine object
+ */
+ConstructiveEngine::~ConstructiveEngine()
+{
+}
+
+/**
+ * @brief Build the bit matrix shared by the engines of a graph
+ *
+ * The bit matrix is only built on dense graphs.
+ *
+ * @param graph The frozen graph
+ * @return std::optional<BitAdjacency> The bit matrix of the graph if it is
+ * dense enough, an empty optional otherwise
+ */
+std::optional<BitAdjacency> ConstructiveEngine::adjacency(const FrozenGraph &graph) // Time complexity: O(n^2 / 64 + m) or O(1)
+{
+    if (!BitAdjacency::fits(graph.size(), graph.edgeCount()))
+        return {};
+    return graph.bitAdjacency();
+}
+
+/**
+ * @brief Build a clique from the whole view
+ *
+ * @return const std::vector<unsigned int>& The indices of the vertices of the
+ * clique, valid until the next run
+ */
+const std::vector<unsigned int> &ConstructiveEngine::run() // Time complexity: O(n + kn / 64) or O(n + km)
+{
+    // The best vertex of the whole view is the first one of the order
+    if (_order.empty())
+    {
+        _clique.clear();
+        _weight = 0;
+        return _clique;
+    }
+    return run(_order.front());
+}
+
+/**
+ * @brief Build a clique from a given vertex of the view
+ *
+ * @param seed The first vertex of the clique
+ * @return const std::vector<unsigned int>& The indices of the vertices of the
+ * clique, valid until the next run
+ */
+const std::vector<unsigned int> &ConstructiveEngine::run(unsigned int seed) // Time complexity: O(n + kn / 64) or O(n + km)
+{
+    _clique.clear();
+    _weight = 0;
+    if (_adjacency)
+        std::copy(_vertexSet.begin(), _vertexSet.end(), _P.begin());
+    else
+        _sparseP.assign(_vertices.begin(), _vertices.end());
+
+    // Add the best vertex of P to the clique until P is empty
+    long unsigned int cursor = 0;
+    unsigned int newVertex = seed;
+    while (true)
+    {
+        add(newVertex);
+        if (!restrict(newVertex))
+            break;
+        newVertex = next(cursor);
+    }
+    return _clique;
+}
+
+/**
+ * @brief Get the best vertex of P
+ *
+ * The vertices before the cursor can't be in P anymore, so the cursor is only
+ * moved forward, up to the best vertex.
+ *
+ * @param cursor The position of the first vertex of the order left to consider
+ * @return unsigned int The best vertex of P, which must not be empty
+ */
+unsigned int ConstructiveEngine::next(long unsigned int &cursor) const // Time complexity: O(n) for a whole run
+{
+    if (_adjacency)
+        while (!BitAdjacency::test(_P.data(), _order[cursor]))
+            cursor++;
+    else
+        while (!std::binary_search(_sparseP.begin(), _sparseP.end(), _order[cursor]))
+            cursor++;
+    return _order[cursor];
+}
+
+/**
+ * @brief Make the intersection of P and the neighbors of a vertex in place
+ *
+ * @param v The vertex
+ * @return true If P is not empty afterwards, false otherwise
+ */
+bool ConstructiveEngine::restrict(unsigned int v) // Time complexity: O(n / 64) or O(|P| + d(v))
+{
+    if (_adjacency)
+    {
+        unsigned int words = _adjacency->words();
+        BitAdjacency::intersect(_P.data(), _P.data(), _adjacency->row(v), words);
+        return BitAdjacency::any(_P.data(), words);
+    }
+
+    // Keep the vertices of P found among the neighbors at the front of P
+    auto neighbors = _graph->neighbors(v);
+    auto neighbor = neighbors.begin();
+    long unsigned int size = 0;
+    for (auto u : _sparseP)
+    {
+        while (neighbor != neighbors.end() && *neighbor < u)
+            ++neighbor;
+        if (neighbor != neighbors.end() && *neighbor == u)
+            _sparseP[size++] = u;
+    }
+    _sparseP.resize(size);
+    return size > 0;
+}
+
+/**
+ * @brief Add a vertex to the clique and its edges to the weight of the clique
+ *
+ * @param v The vertex, adjacent to every vertex of the clique
+ */
+void ConstructiveEngine::add(unsigned int v) // Time complexity: O(k) or O(k log d(v))
+{
+    for (auto u : _clique)
+        _weight += _graph->weight(u, v);
+    _clique.push_back(v);
+}
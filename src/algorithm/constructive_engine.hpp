@@ -0,0 +1,85 @@
+/**
+ * @file constructive_engine.hpp
+ * @brief Declaration of the ConstructiveEngine class and of the orders of the
+ * construction
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "../model/bit_adjacency.hpp"
+#include "../model/frozen_graph.hpp"
+#include "../model/subgraph_view.hpp"
+
+#ifndef CONSTRUCTIVE_ENGINE_HPP
+#define CONSTRUCTIVE_ENGINE_HPP
+
+// Orders of the construction
+std::vector<unsigned int> sortVerticesDegree(const SubgraphView &view);
+std::vector<unsigned int> sortVerticesSumWeight(const SubgraphView &view);
+
+/**
+ * @brief The ConstructiveEngine class
+ *
+ * This class runs the greedy construction of the constructive algorithm on a
+ * subgraph of a frozen graph: the best vertex of P (the first one in a given
+ * order) is added to the clique, P is intersected with its neighbors, and so
+ * on until P is empty. The construction may also start from a given vertex
+ * instead of the best one.
+ *
+ * Everything the construction needs is allocated once by the constructor, so
+ * that run() doesn't allocate and can be called as often as needed. The order
+ * is consumed through a cursor, which only moves forward during a run since
+ * the vertices skipped can't be in P anymore. P is a bitset intersected in
+ * place with the rows of the bit matrix on dense graphs, and a sorted vector
+ * filtered in place with the sorted neighbors otherwise.
+ *
+ * The order and the bit matrix are only read, so the engines of several
+ * workers share them instead of each one building its own.
+ *
+ * The engine is the backend of the multistart algorithm, which runs many
+ * constructions on the same view: its setup (the bit matrix on dense graphs)
+ * only pays off over many runs. A single construction goes through the greedy
+ * kernel of greedy_kernel.hpp instead.
+ *
+ * The graph, the order and the bit matrix must outlive the engine.
+ */
+class ConstructiveEngine
+{
+public:
+    ConstructiveEngine(
+        const SubgraphView &view,
+        const std::vector<unsigned int> &order,
+        const std::optional<BitAdjacency> &adjacency);
+    ~ConstructiveEngine();
+
+    // Get methods
+    inline const std::vector<unsigned int> &clique() const { return _clique; }
+    inline long unsigned int weight() const { return _weight; }
+
+    const std::vector<unsigned int> &run();
+    const std::vector<unsigned int> &run(unsigned int seed);
+
+    static std::optional<BitAdjacency> adjacency(const FrozenGraph &graph);
+
+private:
+    void add(unsigned int v);
+    bool restrict(unsigned int v);
+    unsigned int next(long unsigned int &cursor) const;
+
+    const FrozenGraph *_graph;
+    const std::vector<unsigned int> &_order; // vertices of the view sorted by the criteria (shared)
+    std::vector<uint64_t> _vertexSet;       // bitset of the vertices of the view
+    std::vector<unsigned int> _vertices;    // sorted vertices of the view
+    const BitAdjacency *_adjacency;         // bit matrix of dense graphs (shared), or nullptr
+    std::vector<uint64_t> _P;               // P on dense graphs
+    std::vector<unsigned int> _sparseP;     // P on sparse graphs
+    std::vector<unsigned int> _clique;      // clique built by the last run
+    long unsigned int _weight;              // weight of the clique
+};
+
+#endif // CONSTRUCTIVE_ENGINE_HPP
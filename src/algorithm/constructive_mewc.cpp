@@ -9,179 +9,217 @@
  */
 
 #include <algorithm>
+#include <optional>
+#include <stdexcept>
 #include <vector>
 
+#include "../model/task_pool.hpp"
+#include "constructive_engine.hpp"
+#include "greedy_kernel.hpp"
 #include "mewc.hpp"
 
 /**
- * @brief Returns the vertex with the best criteria
- *
- * The criteria is defined by the order of the vertices in the sortedVertices vector
+ * @brief Finds the maximum weight clique in a graph using a constructive
+ * heuristic algorithm
  *
- * The sortedVertices vector is modified to remove the vertices that have already
- * been considered
+ * The graph is frozen first, so that every score runs on the greedy kernel.
  *
- * @param vertices The vertices to consider
- * @param sortedVertices The vertices sorted by a criteria
- * @return VertexPtr The vertex with the best criteria
+ * @param g The graph
+ * @param options The options of the algorithm (score)
+ * @return Clique A guess of the maximum weight clique
  */
-VertexPtr getBestVertex(
-    const std::unordered_set<VertexPtr> &vertices,
-    std::vector<VertexPtr> &sortedVertices) // O(n)
+Clique constructiveMEWC(const Graph &g, const MEWCOptions &options) // O(n + m log n)
 {
-    VertexPtr bestVertex;
-
-    // Find the first vertex that is in the vertices set
-    for (std::vector<VertexPtr>::iterator it = sortedVertices.begin(); it != sortedVertices.end(); it++)
-    {
-        if (vertices.find(*it) != vertices.end())
-        {
-            bestVertex = *it;
-
-            // Remove the vertices that have already been considered
-            sortedVertices = std::vector<VertexPtr>(it, sortedVertices.end());
-            break;
-        }
-    }
-
-    return bestVertex;
+    return constructiveMEWC(FrozenGraph(g), options);
 }
 
 /**
- * @brief Returns the vertices sorted by degree
+ * @brief Finds the maximum weight clique in a subgraph of a frozen graph using
+ * a constructive heuristic algorithm
  *
- * @param graph The graph
- * @param vertices The vertices to consider
- * @return std::vector<VertexPtr> The vertices sorted by degree
+ * The candidates are chosen by the scoring policy of options.score, each
+ * policy having its own instantiation of the greedy kernel. This is the path of
+ * every single construction (the warm start of exact-bnb and the lower bound of
+ * the kernelization included), the ConstructiveEngine being kept for the many
+ * constructions of the multistart algorithm.
+ *
+ * @param view The subgraph view
+ * @param options The options of the algorithm (score)
+ * @return Clique A guess of the maximum weight clique
+ * @throws std::invalid_argument If the score is invalid
  */
-std::vector<VertexPtr> sortVerticesDegree(
-    const Graph &graph,
-    const std::unordered_set<VertexPtr> &vertices) // O(nlogn)
+Clique constructiveMEWC(const SubgraphView &view, const MEWCOptions &options) // O(n + m log n)
 {
-    std::vector<std::pair<VertexPtr, long unsigned int>> degrees;
-    std::vector<VertexPtr> sortedVertices;
-
-    // Allocate the vectors
-    degrees.reserve(vertices.size());
-    sortedVertices.reserve(vertices.size());
-
-    // Get the degrees
-    auto adjMatrix = graph.adjacencyMatrix();
-    for (auto vertex : vertices)
+    switch (options.score)
     {
-        auto neighbors = adjMatrix[vertex->id()];
-        degrees.push_back(std::make_pair(vertex, neighbors.size()));
+    case Score::Degree:
+        return view.graph().clique(greedyClique<DegreeScore>(view));
+    case Score::WeightedDegree:
+        return view.graph().clique(greedyClique<WeightedDegreeScore>(view));
+    case Score::Gain:
+        return view.graph().clique(greedyClique<GainScore>(view));
+    case Score::GainDegree:
+        return view.graph().clique(greedyClique<GainDegreeScore>(view));
+    case Score::DegreeWeight:
+        return view.graph().clique(greedyClique<DegreeWeightScore>(view));
+    default:
+        throw std::invalid_argument("Invalid score");
     }
-
-    // Sort the vertices by degree
-    std::sort(degrees.begin(), degrees.end(), [](const auto &a, const auto &b)
-              { return a.second > b.second; });
-
-    // Get the vertices
-    for (const auto &[vertex, degree] : degrees)
-        sortedVertices.push_back(vertex);
-
-    return sortedVertices;
 }
 
 /**
- * @brief Returns the vertices sorted by the sum of their edges weights
+ * @brief Finds the maximum weight clique in a frozen graph using a constructive
+ * heuristic algorithm
  *
- * @param graph The graph
- * @param vertices The vertices to consider
- * @return std::vector<VertexPtr> The vertices sorted by the sum of their edges weights
+ * @param g The frozen graph
+ * @param options The options of the algorithm (score)
+ * @return Clique A guess of the maximum weight clique
  */
-std::vector<VertexPtr> sortVerticesSumWeight(
-    const Graph &graph,
-    const std::unordered_set<VertexPtr> &vertices) // O(n^2)
+Clique constructiveMEWC(const FrozenGraph &g, const MEWCOptions &options) // O(n + m log n)
 {
-    std::vector<std::pair<VertexPtr, long unsigned int>> weights;
-    std::vector<VertexPtr> sortedVertices;
-
-    // Allocate the vectors
-    weights.reserve(vertices.size());
-    sortedVertices.reserve(vertices.size());
+    return constructiveMEWC(SubgraphView(g), options);
+}
 
-    // Get the weights
-    auto adjMatrix = graph.adjacencyMatrix();
-    for (auto vertex : vertices)
-    {
-        long unsigned int weight = 0;
-        auto neighbors = adjMatrix[vertex->id()];
-        for (const auto &[neighbor, edge] : neighbors)
-        {
-            weight += edge->weight();
-        }
-        weights.push_back(std::make_pair(vertex, weight));
-    }
+/**
+ * @brief Finds the maximum weight clique in a subgraph of a frozen graph by
+ * running the constructive heuristic from several vertices
+ *
+ * The construction is run once from the best vertex, like constructiveMEWC(),
+ * then from each of the first options.starts vertices by weighted degree (all
+ * of them if options.starts is 0), and the heaviest clique is kept. The starts
+ * are split between options.threads workers, each one with its own
+ * ConstructiveEngine whose buffers are reused from one start to the next. The
+ * order and the bit matrix are built once and shared by the engines.
+ *
+ * On equal weights the clique of the earliest start is kept, so the result
+ * doesn't depend on the number of threads.
+ *
+ * @param view The subgraph view
+ * @param options The options of the algorithm (threads, starts)
+ * @return Clique A guess of the maximum weight clique
+ */
+Clique constructiveMultistartMEWC(const SubgraphView &view, const MEWCOptions &options) // O(sn^2 / 64t)
+{
+    const FrozenGraph &g = view.graph();
+    std::vector<unsigned int> sortedVertices = sortVerticesDegree(view); // O(m + nlogn)
+
+    // The first start is the best vertex, the next ones are the seeds, unless
+    // the best vertex is already one of them
+    std::vector<unsigned int> seeds = sortVerticesSumWeight(view); // O(m + nlogn)
+    if (options.starts > 0 && options.starts < seeds.size())
+        seeds.resize(options.starts);
+    if (!sortedVertices.empty() && std::find(seeds.begin(), seeds.end(), sortedVertices.front()) == seeds.end())
+        seeds.insert(seeds.begin(), sortedVertices.front());
+
+    // The bit matrix is built once and shared by the engines of the workers
+    std::optional<BitAdjacency> adjacency = ConstructiveEngine::adjacency(g); // O(n^2 / 64 + m)
+
+    unsigned int workers = std::max(1u, std::min<unsigned int>(options.threads, seeds.size()));
+    std::vector<std::optional<ConstructiveEngine>> engines(workers);
+    std::vector<std::vector<unsigned int>> best_cliques(workers);
+    std::vector<long int> best_weights(workers, -1);
+    std::vector<long unsigned int> best_starts(workers, 0);
+
+    // The owner of a deque pops its newest start first, so the starts are
+    // pushed from the last to the first
+    TaskPool<long unsigned int> pool(workers);
+    for (long unsigned int i = seeds.size(); i-- > 0;)
+        pool.push(i % workers, i);
+
+    pool.run([&](unsigned int worker, long unsigned int &start)
+             {
+                 if (!engines[worker])
+                     engines[worker].emplace(view, sortedVertices, adjacency); // O(n)
+                 ConstructiveEngine &engine = engines[worker].value();
+                 engine.run(seeds[start]);
+
+                 long int weight = engine.weight();
+                 if (weight > best_weights[worker] ||
+                     (weight == best_weights[worker] && start < best_starts[worker]))
+                 {
+                     best_cliques[worker] = engine.clique();
+                     best_weights[worker] = weight;
+                     best_starts[worker] = start;
+                 } });
+
+    long unsigned int best = 0;
+    for (unsigned int worker = 1; worker < workers; worker++)
+        if (best_weights[worker] > best_weights[best] ||
+            (best_weights[worker] == best_weights[best] && best_starts[worker] < best_starts[best]))
+            best = worker;
+
+    return g.clique(best_cliques[best]);
+}
 
-    // Sort the vertices by weight
-    std::sort(weights.begin(), weights.end(), [](const auto &a, const auto &b)
-              { return a.second > b.second; });
+/**
+ * @brief Finds the maximum weight clique in a frozen graph by running the
+ * constructive heuristic from several vertices
+ *
+ * @param g The frozen graph
+ * @param options The options of the algorithm (threads, starts)
+ * @return Clique A guess of the maximum weight clique
+ */
+Clique constructiveMultistartMEWC(const FrozenGraph &g, const MEWCOptions &options)
+{
+    return constructiveMultistartMEWC(SubgraphView(g), options);
+}
 
-    // Get the vertices
-    for (const auto &[vertex, weight] : weights)
-        sortedVertices.push_back(vertex);
+/**
+ * @brief Finds the maximum weight clique in a graph by running the
+ * constructive heuristic from several vertices
+ *
+ * The graph is frozen first, the algorithm only works on frozen graphs.
+ *
+ * @param g The graph
+ * @param options The options of the algorithm (threads, starts)
+ * @return Clique A guess of the maximum weight clique
+ */
+Clique constructiveMultistartMEWC(const Graph &g, const MEWCOptions &options)
+{
+    return constructiveMultistartMEWC(FrozenGraph(g), options);
+}
 
-    return sortedVertices;
+/**
+ * @brief Finds the maximum weight clique in a subgraph of a frozen graph using
+ * a constructive heuristic algorithm driven by the gains of the candidates
+ *
+ * Instead of following a fixed order, the construction adds to the clique the
+ * candidate with the highest gain, that is the highest sum of the weights of
+ * its edges to the clique, which is the weight it actually adds to the clique.
+ * The ties, and the first vertex, are decided by the sum of the weights of all
+ * the edges of the candidates. This is the constructive algorithm with the
+ * GainScore policy.
+ *
+ * @param view The subgraph view
+ * @return Clique A guess of the maximum weight clique
+ */
+Clique constructiveGainMEWC(const SubgraphView &view) // O(n + m log n)
+{
+    return view.graph().clique(greedyClique<GainScore>(view));
 }
 
 /**
- * @brief The recursive function of the constructive MEWC algorithm
+ * @brief Finds the maximum weight clique in a frozen graph using a constructive
+ * heuristic algorithm driven by the gains of the candidates
  *
- * @param g The graph
- * @param clique The clique
- * @param P The set of vertices to consider
+ * @param g The frozen graph
+ * @return Clique A guess of the maximum weight clique
  */
-void constructiveMEWCRecursive(
-    const Graph &g,
-    Clique &clique,
-    const std::unordered_set<VertexPtr> &P,
-    std::vector<VertexPtr> &sortedVertices)
+Clique constructiveGainMEWC(const FrozenGraph &g) // O(n + m log n)
 {
-    // Base case: Return if P is empty
-    if (P.empty())
-        return;
-
-    // Get the best vertex and add it to the clique
-    // LaTeX : v \gets \argmax_{v \in P} d(v) \Comment{Get the vertex with the highest degree}
-    // LaTeX : v \gets \argmax_{v \in P} \sum_{u \in \N(v)} w(u,v) \Comment{Get the vertex with the highest sum of weights}
-    VertexPtr newVertex = getBestVertex(P, sortedVertices);
-    // LaTeX : R \gets R \cup \{v\}
-    clique.addVertex(newVertex);
-
-    std::unordered_set<VertexPtr> new_P;
-
-    // Make the intersection of P and the neighbors of newVertex
-    auto adjMatrix = g.adjacencyMatrix();
-    for (const auto &[neighbor, _] : adjMatrix[newVertex->id()])
-        if (P.count(*(g.getVertex(neighbor))) != 0)
-            new_P.insert(*(g.getVertex(neighbor)));
-
-    // Make the recursive call
-    // LaTeX : \Call{ConstructiveRecursiveMEWC}{$R$, $P \cap (\N(v) \cup {v})$}
-    constructiveMEWCRecursive(g, clique, new_P, sortedVertices);
+    return constructiveGainMEWC(SubgraphView(g));
 }
 
 /**
  * @brief Finds the maximum weight clique in a graph using a constructive
- * heuristic algorithm
+ * heuristic algorithm driven by the gains of the candidates
+ *
+ * The graph is frozen first, the algorithm only works on frozen graphs.
  *
  * @param g The graph
  * @return Clique A guess of the maximum weight clique
  */
-Clique constructiveMEWC(const Graph &g) // O(n^2)
+Clique constructiveGainMEWC(const Graph &g)
 {
-    // LaTeX : $R \gets \emptyset$
-    Clique clique;
-    // LaTeX : $P \gets V$
-    std::unordered_set<VertexPtr> P = g.vertices();
-    std::vector<VertexPtr> sortedVertices = sortVerticesDegree(g, P); // O(nlogn)
-    // std::vector<VertexPtr> sortedVertices = sortVerticesSumWeight(g, P); // O(n^2)
-
-    // LaTeX : \Call{ConstructiveRecursiveMEWC}{$R$, $P$}
-    constructiveMEWCRecursive(g, clique, P, sortedVertices); // O(n^2)
-
-    // LaTeX : \Return R
-    return clique;
-}
+    return constructiveGainMEWC(FrozenGraph(g));
+}
\ No newline at end of file
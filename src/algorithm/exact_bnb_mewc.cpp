@@ -0,0 +1,540 @@
+/**
+ * @file exact_bnb_mewc.cpp
+ * @brief This file contains the implementation of the branch and bound MEWC algorithm
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "../model/task_pool.hpp"
+#include "exact_bnb_mewc.hpp"
+#include "greedy_kernel.hpp"
+#include "mewc.hpp"
+#include "search_monitor.hpp"
+
+/**
+ * @brief The heaviest clique found so far by a branch and bound search
+ *
+ * The weight is atomic so that the workers of a parallel search can prune
+ * against the best clique found by any of them without locking, the clique
+ * itself being only locked when it is replaced. The weight is -1 as long as
+ * no clique has been found, so that nothing is pruned until then.
+ */
+class BnBIncumbent
+{
+public:
+    BnBIncumbent() : _weight(-1) {}
+
+    // Get methods
+    inline std::vector<unsigned int> clique() const { return _clique; }
+
+    // Boolean methods
+    inline bool isBeatenBy(long unsigned int weight) const
+    {
+        return static_cast<long int>(weight) > _weight.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Replace the incumbent by a clique if it is heavier
+     *
+     * @param clique The clique
+     * @param weight The weight of the clique
+     * @return true If the clique replaced the incumbent, false otherwise
+     */
+    bool offer(const std::vector<unsigned int> &clique, long unsigned int weight)
+    {
+        if (!isBeatenBy(weight))
+            return false;
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!isBeatenBy(weight))
+            return false;
+        _clique = clique;
+        _weight.store(weight);
+        return true;
+    }
+
+private:
+    std::atomic<long int> _weight;
+    std::mutex _mutex;
+    std::vector<unsigned int> _clique;
+};
+
+/**
+ * @brief A node of the branch and bound search to explore, as a task of a
+ * parallel search
+ */
+struct BnBTask
+{
+    std::vector<unsigned int> R;
+    long unsigned int R_weight;
+    std::vector<BnBCandidate> P;
+};
+
+/**
+ * @brief Color the candidates of a node of the search and compute their bounds
+ *
+ * The candidates are greedily colored so that two adjacent candidates never
+ * share a color, which means that a clique holds at most one candidate per
+ * color class.
+ *
+ * Each edge of a clique made of candidates is charged to its endpoint of
+ * higher class, so a candidate adds to the clique its gain plus at most one
+ * edge to each lower class: the heaviest edge between the candidate and that
+ * class. The bound of a color class is the best bound of its candidates, and
+ * the bound of the first classes is the sum of their bounds.
+ *
+ * The candidates are reordered class by class, and bounds[i] is an upper bound
+ * of the weight that the candidates 0 to i can add to the clique.
+ *
+ * @param graph The frozen graph
+ * @param P The candidates, reordered by color class
+ * @param bounds The upper bounds of the prefixes of P
+ */
+void colorBound(
+    const FrozenGraph &graph,
+    std::vector<BnBCandidate> &P,
+    std::vector<long unsigned int> &bounds) // O(|P|^2)
+{
+    // Greedy coloring: each candidate goes to the first class where it has no
+    // neighbor
+    std::vector<std::vector<BnBCandidate>> classes;
+    for (const auto &candidate : P)
+    {
+        auto it = classes.begin();
+        for (; it != classes.end(); ++it)
+            if (std::none_of(it->begin(), it->end(), [&](const BnBCandidate &other)
+                             { return graph.hasEdge(candidate.vertex, other.vertex); }))
+                break;
+        if (it == classes.end())
+            it = classes.emplace(classes.end());
+        it->push_back(candidate);
+    }
+
+    // Reorder the candidates class by class and compute the bounds of the
+    // prefixes: the bounds of the previous classes plus the best bound so far
+    // in the current class
+    P.clear();
+    bounds.clear();
+    long unsigned int previous_classes = 0;
+    for (const auto &color_class : classes)
+    {
+        long unsigned int best = 0;
+        for (const auto &candidate : color_class)
+        {
+            // P holds the candidates of the lower classes, grouped by class
+            long unsigned int bound = candidate.gain;
+            long unsigned int class_start = 0;
+            for (const auto &lower_class : classes)
+            {
+                if (&lower_class == &color_class)
+                    break;
+                unsigned int heaviest = 0;
+                for (long unsigned int j = class_start; j < class_start + lower_class.size(); j++)
+                    heaviest = std::max(heaviest, graph.weight(candidate.vertex, P[j].vertex));
+                bound += heaviest;
+                class_start += lower_class.size();
+            }
+
+            best = std::max(best, bound);
+            bounds.push_back(previous_classes + best);
+        }
+        for (const auto &candidate : color_class)
+            P.push_back(candidate);
+        previous_classes += best;
+    }
+}
+
+/**
+ * @brief Finds the maximum weight clique of a frozen graph by branch and bound
+ *
+ * The candidates are the vertices adjacent to the whole current clique R. They
+ * are tried from the last one to the first one, the clique being extended with
+ * a candidate and its neighbors among the previous candidates. A branch is
+ * discarded as soon as the weight of R plus the bound of the candidates left
+ * can't beat the best clique found so far.
+ *
+ * In a parallel search, the branches are pushed to the pool instead of being
+ * explored while some worker is waiting for a task, so that the subtrees are
+ * split as deep as needed to keep every worker busy.
+ *
+ * @param graph The frozen graph
+ * @param R The current clique
+ * @param R_weight The weight of the current clique
+ * @param P The candidates to extend the current clique with
+ * @param incumbent The heaviest clique found so far
+ * @param monitor The monitor of the search, which may stop it
+ * @param pool The pool of a parallel search, or nullptr
+ * @param worker The worker running the search in the pool
+ */
+void branchAndBound(
+    const FrozenGraph &graph,
+    std::vector<unsigned int> &R,
+    long unsigned int R_weight,
+    std::vector<BnBCandidate> &P,
+    BnBIncumbent &incumbent,
+    SearchMonitor &monitor,
+    TaskPool<BnBTask> *pool,
+    unsigned int worker)
+{
+    if (!monitor.visit())
+        return;
+
+    // Base case : R can't be extended anymore
+    if (P.empty())
+    {
+        if (incumbent.offer(R, R_weight))
+            monitor.improveIncumbent(R_weight);
+        return;
+    }
+
+    std::vector<long unsigned int> bounds;
+    colorBound(graph, P, bounds); // O(|P|^2)
+
+    std::vector<BnBCandidate> P_new;
+    for (long unsigned int i = P.size(); i-- > 0;)
+    {
+        // The previous branch may have been cut short
+        if (monitor.stopped())
+            return;
+
+        // The bounds only decrease from here, so the other candidates can't
+        // do better either
+        if (!incumbent.isBeatenBy(R_weight + bounds[i]))
+            return;
+
+        // The root branches are explored from the last one, so no clique is
+        // heavier than the bound of the candidates left, unless it has already
+        // been found (in a parallel search, the branches pushed to the pool
+        // may not have been explored yet, so only the first bound holds)
+        if (R.empty() && (pool == nullptr || i + 1 == P.size()))
+            monitor.setBound(bounds[i]);
+
+        // Keep the previous candidates adjacent to the current one, along with
+        // the weight of their edge to it
+        unsigned int v = P[i].vertex;
+        P_new.clear();
+        for (long unsigned int j = 0; j < i; j++)
+        {
+            unsigned int weight = graph.weight(P[j].vertex, v);
+            if (weight != 0 || graph.hasEdge(P[j].vertex, v))
+                P_new.push_back({P[j].vertex, P[j].gain + weight});
+        }
+
+        R.push_back(v);
+        if (pool != nullptr && i > 0 && pool->hungry())
+            pool->push(worker, {R, R_weight + P[i].gain, P_new});
+        else
+            branchAndBound(graph, R, R_weight + P[i].gain, P_new, incumbent, monitor, pool, worker);
+        R.pop_back();
+    }
+}
+
+/**
+ * @brief The heaviest maximal cliques found so far by a top-k search
+ *
+ * The cliques are kept in a min-heap bounded to k cliques, so that the
+ * lightest one is the first to be replaced by a heavier clique.
+ */
+class TopKCliques
+{
+public:
+    TopKCliques(unsigned int k) : _k(k) {}
+
+    // Get methods
+
+    // Weight that a clique must beat to enter, -1 as long as there are less
+    // than k cliques
+    inline long int threshold() const
+    {
+        return _heap.size() < _k ? -1 : static_cast<long int>(_heap.front().first);
+    }
+
+    /**
+     * @brief Get the cliques, from the heaviest to the lightest
+     *
+     * @return std::vector<std::pair<long unsigned int, std::vector<unsigned int>>>
+     * The weights and the vertices of the cliques
+     */
+    std::vector<std::pair<long unsigned int, std::vector<unsigned int>>> sorted() const
+    {
+        auto cliques = _heap;
+        std::sort_heap(cliques.begin(), cliques.end(), std::greater<>());
+        return cliques;
+    }
+
+    /**
+     * @brief Add a clique if it is heavier than the lightest of the k cliques
+     *
+     * @param clique The clique
+     * @param weight The weight of the clique
+     */
+    void offer(const std::vector<unsigned int> &clique, long unsigned int weight) // O(log k)
+    {
+        if (_k == 0 || static_cast<long int>(weight) <= threshold())
+            return;
+        _heap.emplace_back(weight, clique);
+        std::push_heap(_heap.begin(), _heap.end(), std::greater<>());
+        if (_heap.size() > _k)
+        {
+            std::pop_heap(_heap.begin(), _heap.end(), std::greater<>());
+            _heap.pop_back();
+        }
+    }
+
+private:
+    unsigned int _k;
+    std::vector<std::pair<long unsigned int, std::vector<unsigned int>>> _heap;
+};
+
+/**
+ * @brief Finds the heaviest maximal cliques of a frozen graph by branch and
+ * bound
+ *
+ * This is the same search as branchAndBound(), but it keeps the k heaviest
+ * cliques instead of the heaviest one, and only the maximal ones. A branch is
+ * discarded as soon as it can't beat the lightest of the k cliques.
+ *
+ * The vertices adjacent to the whole current clique are either candidates or
+ * in X, which holds the ones that have already been tried in another branch
+ * (or in a branch of an ancestor). R is only maximal when both are empty.
+ *
+ * @param graph The frozen graph
+ * @param R The current clique
+ * @param R_weight The weight of the current clique
+ * @param P The candidates to extend the current clique with
+ * @param X The other vertices adjacent to the current clique
+ * @param top The heaviest maximal cliques found so far
+ * @param monitor The monitor of the search, which may stop it
+ */
+void topKBranchAndBound(
+    const FrozenGraph &graph,
+    std::vector<unsigned int> &R,
+    long unsigned int R_weight,
+    std::vector<BnBCandidate> &P,
+    const std::vector<unsigned int> &X,
+    TopKCliques &top,
+    SearchMonitor &monitor)
+{
+    if (!monitor.visit())
+        return;
+
+    // Base case : R can't be extended anymore, it is maximal if X is empty,
+    // and the progress shows the weight of the lightest of the k cliques
+    if (P.empty())
+    {
+        if (X.empty())
+            top.offer(R, R_weight);
+        if (top.threshold() >= 0)
+            monitor.improveIncumbent(top.threshold());
+        return;
+    }
+
+    std::vector<long unsigned int> bounds;
+    colorBound(graph, P, bounds); // O(|P|^2)
+
+    std::vector<BnBCandidate> P_new;
+    std::vector<unsigned int> X_new;
+    for (long unsigned int i = P.size(); i-- > 0;)
+    {
+        if (monitor.stopped())
+            return;
+
+        // The bounds only decrease from here, so the other candidates can't
+        // do better either
+        if (static_cast<long int>(R_weight + bounds[i]) <= top.threshold())
+            return;
+
+        // Keep the previous candidates adjacent to the current one, along with
+        // the weight of their edge to it, and move the next ones to X
+        unsigned int v = P[i].vertex;
+        P_new.clear();
+        X_new.clear();
+        for (long unsigned int j = 0; j < P.size(); j++)
+        {
+            if (j == i || !graph.hasEdge(P[j].vertex, v))
+                continue;
+            if (j < i)
+                P_new.push_back({P[j].vertex, P[j].gain + graph.weight(P[j].vertex, v)});
+            else
+                X_new.push_back(P[j].vertex);
+        }
+        for (auto x : X)
+            if (graph.hasEdge(x, v))
+                X_new.push_back(x);
+
+        R.push_back(v);
+        topKBranchAndBound(graph, R, R_weight + P[i].gain, P_new, X_new, top, monitor);
+        R.pop_back();
+    }
+}
+
+/**
+ * @brief Finds the k heaviest maximal cliques in a subgraph of a frozen graph
+ *
+ * The cliques are distinct, each maximal clique being found at most once. If
+ * the subgraph has less than k maximal cliques, they are all returned.
+ *
+ * @param view The subgraph view
+ * @param k The number of cliques
+ * @param options The options of the algorithm (time limit, progress)
+ * @return std::vector<Clique> The cliques, from the heaviest to the lightest
+ */
+std::vector<Clique> topKMEWC(const SubgraphView &view, unsigned int k, const MEWCOptions &options)
+{
+    const FrozenGraph &g = view.graph();
+    SearchMonitor monitor("top-k", options.timeLimit, options.progress);
+
+    std::vector<unsigned int> vertices = view.vertices();
+    std::vector<long unsigned int> weights(g.size(), 0);
+    for (auto v : vertices)
+        weights[v] = view.weightedDegree(v);
+    std::stable_sort(vertices.begin(), vertices.end(), [&weights](unsigned int a, unsigned int b)
+                     { return weights[a] > weights[b]; });
+
+    std::vector<BnBCandidate> P;
+    P.reserve(vertices.size());
+    for (auto v : vertices)
+        P.push_back({v, 0});
+
+    TopKCliques top(k);
+    std::vector<unsigned int> R;
+    topKBranchAndBound(g, R, 0, P, {}, top, monitor);
+    monitor.report();
+
+    std::vector<Clique> cliques;
+    for (const auto &[weight, clique] : top.sorted())
+        cliques.push_back(g.clique(clique));
+    return cliques;
+}
+
+/**
+ * @brief Finds the k heaviest maximal cliques in a frozen graph
+ *
+ * @param g The frozen graph
+ * @param k The number of cliques
+ * @param options The options of the algorithm (time limit, progress)
+ * @return std::vector<Clique> The cliques, from the heaviest to the lightest
+ */
+std::vector<Clique> topKMEWC(const FrozenGraph &g, unsigned int k, const MEWCOptions &options)
+{
+    return topKMEWC(SubgraphView(g), k, options);
+}
+
+/**
+ * @brief Finds the maximum weight clique in a subgraph of a frozen graph using
+ * a branch and bound algorithm
+ *
+ * Unlike exactMEWC, which enumerates all the maximal cliques, this algorithm
+ * keeps the best clique found so far and prunes the branches that can't beat
+ * it, using the coloring bound of colorBound().
+ *
+ * The vertices are first sorted by decreasing weighted degree, so that the
+ * heaviest ones are colored first and tried last.
+ *
+ * With several threads, the search tree is explored by a pool of workers with
+ * work stealing, which share the heaviest clique found so far. The weight of
+ * the clique found is the same, but among cliques of the same weight the one
+ * found may differ from one run to another.
+ *
+ * With a warm start, the incumbent is first the clique found by a heuristic,
+ * which is returned if no heavier clique exists.
+ *
+ * With a time limit, the incumbent is returned when the limit is reached,
+ * without proof that it is the maximum clique.
+ *
+ * @param view The subgraph view
+ * @param options The options of the algorithm (threads, warm start, time
+ * limit, progress, shared monitor)
+ * @return Clique The maximum weight clique
+ */
+Clique exactBnBMEWC(const SubgraphView &view, const MEWCOptions &options)
+{
+    const FrozenGraph &g = view.graph();
+
+    std::vector<unsigned int> vertices = view.vertices();
+    std::vector<long unsigned int> weights(g.size(), 0);
+    for (auto v : vertices)
+        weights[v] = view.weightedDegree(v);
+    std::stable_sort(vertices.begin(), vertices.end(), [&weights](unsigned int a, unsigned int b)
+                     { return weights[a] > weights[b]; });
+
+    std::vector<BnBCandidate> P;
+    P.reserve(vertices.size());
+    for (auto v : vertices)
+        P.push_back({v, 0});
+
+    SearchMonitor own_monitor("exact-bnb", options.timeLimit, options.progress);
+    SearchMonitor &monitor = options.monitor != nullptr ? *options.monitor : own_monitor;
+
+    // Seed the incumbent with a heuristic clique, so that only the branches
+    // that can beat it are explored. The constructive one is built by the
+    // greedy kernel, straight into indices
+    BnBIncumbent incumbent;
+    if (options.warmStart.has_value())
+    {
+        std::vector<unsigned int> indices;
+        if (options.warmStart == Algorithm::LocalSearch)
+            indices = g.indices(localSearchMEWC(view));
+        else
+            indices = greedyClique<DegreeScore>(view); // O(n + m log n)
+        if (!indices.empty() && incumbent.offer(indices, g.weight(indices)))
+            monitor.improveIncumbent(g.weight(indices));
+    }
+
+    if (options.threads > 1)
+    {
+        TaskPool<BnBTask> pool(options.threads);
+        pool.push(0, {{}, 0, P});
+        pool.run([&g, &incumbent, &monitor, &pool](unsigned int worker, BnBTask &task)
+                 { branchAndBound(g, task.R, task.R_weight, task.P, incumbent, monitor, &pool, worker); });
+    }
+    else
+    {
+        std::vector<unsigned int> R;
+        branchAndBound(g, R, 0, P, incumbent, monitor, nullptr, 0);
+    }
+
+    // Once the search is complete, the incumbent is the maximum clique
+    if (!monitor.stopped())
+        monitor.setBound(g.weight(incumbent.clique()));
+    if (options.monitor == nullptr)
+        monitor.report();
+
+    return g.clique(incumbent.clique());
+}
+
+/**
+ * @brief Finds the maximum weight clique in a frozen graph using a branch and
+ * bound algorithm
+ *
+ * @param g The frozen graph
+ * @param options The options of the algorithm (threads, warm start, time
+ * limit, progress)
+ * @return Clique The maximum weight clique
+ */
+Clique exactBnBMEWC(const FrozenGraph &g, const MEWCOptions &options)
+{
+    return exactBnBMEWC(SubgraphView(g), options);
+}
+
+/**
+ * @brief Finds the maximum weight clique in a graph using a branch and bound
+ * algorithm
+ *
+ * The graph is frozen first, the algorithm only works on frozen graphs.
+ *
+ * @param g The graph
+ * @param options The options of the algorithm (threads, warm start, time
+ * limit, progress)
+ * @return Clique The maximum weight clique
+ */
+Clique exactBnBMEWC(const Graph &g, const MEWCOptions &options)
+{
+    return exactBnBMEWC(FrozenGraph(g), options);
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+/**
+ * @file exact_bnb_mewc.hpp
+ * @brief Declaration of the candidates and of the coloring bound of the
+ * branch and bound MEWC algorithm
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <vector>
+
+#include "../model/frozen_graph.hpp"
+
+#ifndef EXACT_BNB_MEWC_HPP
+#define EXACT_BNB_MEWC_HPP
+
+/**
+ * @brief A candidate vertex of the branch and bound search
+ *
+ * The gain of a candidate is the weight of its edges to the current clique, so
+ * that adding it to the clique adds its gain to the weight of the clique.
+ */
+struct BnBCandidate
+{
+    unsigned int vertex;
+    long unsigned int gain;
+};
+
+void colorBound(const FrozenGraph &graph, std::vector<BnBCandidate> &P, std::vector<long unsigned int> &bounds);
+
+#endif // EXACT_BNB_MEWC_HPP
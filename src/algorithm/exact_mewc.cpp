@@ -6,116 +6,831 @@
  * @date 2022-12-30
  */
 
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
 #include <vector>
 
+#include "../model/task_pool.hpp"
+#include "checkpoint.hpp"
 #include "mewc.hpp"
+#include "search_monitor.hpp"
 
 /**
- * @brief Finds the maximal cliques in a graph using the Bron-Kerbosch algorithm
+ * @brief Finds the maximum weight clique in a graph using an exact algorithm
  *
- * This function finds all maximal cliques in a graph using the Bron-Kerbosch
- * algorithm. The algorithm is implemented recursively.
+ * The graph is frozen first, so that both entry points run the same search
+ * (with the bit matrix only on dense graphs, the threads, the time limit and
+ * the checkpoints).
  *
- * The time complexity of this function is O(3^(n/3)), where n is the number of
- * vertices in the graph.
- * (https://en.wikipedia.org/wiki/Bron%E2%80%93Kerbosch_algorithm)
+ * @param g The graph
+ * @param options The options of the algorithm (pivot rule, engine, threads,
+ * time limit, progress, checkpoint, resume)
+ * @return The maximum weight clique
+ */
+Clique exactMEWC(const Graph &g, const MEWCOptions &options)
+{
+    return exactMEWC(FrozenGraph(g), options);
+}
+
+/**
+ * @brief Choose the pivot vertex of a call of the Bron-Kerbosch algorithm on a
+ * frozen graph
+ *
+ * With the Tomita rule, the pivot is the vertex of P U X with the most
+ * neighbors in P, which leaves the fewest vertices of P to branch on and makes
+ * the enumeration worst-case optimal (Tomita, Tanaka and Takahashi, 2006).
+ * With the First rule, it is just any vertex of P.
  *
- * @param g The graph to find the maximal cliques in
+ * P and X are sorted vectors of indices, and the neighbors of a vertex in P are
+ * counted by a linear merge.
+ *
+ * @param graph The frozen graph
+ * @param P The sorted set of candidate vertices, not empty
+ * @param X The sorted set of excluded vertices
+ * @param rule The pivot rule
+ * @return unsigned int The pivot vertex
+ */
+unsigned int choosePivot(
+    const FrozenGraph &graph,
+    const std::vector<unsigned int> &P,
+    const std::vector<unsigned int> &X,
+    Pivot rule) // O(|P U X| * (|P| + d))
+{
+    unsigned int pivot = P.front();
+    if (rule == Pivot::First)
+        return pivot;
+
+    long int max_count = -1;
+    for (const auto *set : {&P, &X})
+        for (auto u : *set)
+        {
+            auto neighbors = graph.neighbors(u);
+            long int count = 0;
+            auto it = P.begin();
+            auto jt = neighbors.begin();
+            while (it != P.end() && jt != neighbors.end())
+            {
+                if (*it < *jt)
+                    ++it;
+                else if (*jt < *it)
+                    ++jt;
+                else
+                {
+                    count++;
+                    ++it;
+                    ++jt;
+                }
+            }
+            if (count > max_count)
+            {
+                max_count = count;
+                pivot = u;
+            }
+        }
+    return pivot;
+}
+
+/**
+ * @brief Finds the maximal cliques in a frozen graph using the Bron-Kerbosch
+ * algorithm
+ *
+ * This is the same algorithm as above, but working on the dense indices of a
+ * FrozenGraph. The sets P and X are sorted vectors of indices, so that their
+ * intersection with the (sorted) neighborhood of a vertex is a linear merge
+ * instead of a hash lookup per element. The weight of R is maintained
+ * incrementally and given to the visitor along with R.
+ *
+ * @param graph The frozen graph to find the maximal cliques in
  * @param R The current clique
+ * @param R_weight The weight of the current clique
  * @param P The set of vertices that are adjacent to the current clique
  * @param X The set of vertices that are not adjacent to the current clique
- * @param cliques The vector of cliques to add the maximal cliques to
+ * @param visitor The function to call on each maximal clique
+ * @param rule The pivot rule
+ * @param monitor The monitor of the search, which may stop it
  */
 void BronKerbosch(
-    const Graph &graph,
-    Clique &R,
-    std::unordered_set<VertexPtr> &P,
-    std::unordered_set<VertexPtr> &X,
-    std::vector<Clique> &cliques)
+    const FrozenGraph &graph,
+    std::vector<unsigned int> &R,
+    long unsigned int R_weight,
+    std::vector<unsigned int> &P,
+    std::vector<unsigned int> &X,
+    const CliqueVisitor &visitor,
+    Pivot rule,
+    SearchMonitor &monitor)
 {
-    // Base case : if P and X are empty, add the clique R to the vector of cliques
+    if (!monitor.visit())
+        return;
+
+    // Base case : if P and X are empty, R is a maximal clique
     if (P.empty() && X.empty())
-        cliques.push_back(R);
+        visitor(R, R_weight);
     // If only P is empty, backtrack
     if (P.empty())
         return;
 
-    // Chose a pivot vertex from P
-    // (Technically it would be from P U X but since if P is empty, we backtrack,
-    // we can just chose a vertex from P. And, normally we would have a condition
-    // on the choice of the pivot vertex but it would induce additional complexity
-    // that isn't worth it.)
-    VertexPtr pivot = *P.begin();
+    // Chose a pivot vertex from P U X
+    unsigned int pivot = choosePivot(graph, P, X, rule);
 
     // Create a copy of P without the neighbors of the pivot vertex
-    std::unordered_set<VertexPtr> P_copy;
-    for (auto v : P)
-        if (!graph.hasEdge(v, pivot))
-            P_copy.insert(v);
+    std::vector<unsigned int> P_copy;
+    auto pivot_neighbors = graph.neighbors(pivot);
+    std::set_difference(P.begin(), P.end(),
+                        pivot_neighbors.begin(), pivot_neighbors.end(),
+                        std::back_inserter(P_copy));
 
-    // Recursive case : iterate through the vector of vertices in the copy of P
+    // Recursive case : iterate through the vertices in the copy of P
     for (auto v : P_copy)
     {
-        // Create a new clique with the current vertex
-        Clique R_new = R;
-        R_new.addVertex(v);
-
-        // Create a new vector of vertices for the recursive call with the
-        // vertices in P that are adjacent to the current vertex
-        std::unordered_set<VertexPtr> P_new;
-        for (auto w : P)
-            if (graph.getEdge(v, w))
-                P_new.insert(w);
-
-        // Create a new vector of vertices for the recursive call with the
-        // vertices in X that are adjacent to the current vertex
-        std::unordered_set<VertexPtr> X_new;
-        for (auto w : X)
-            if (graph.getEdge(v, w))
-                X_new.insert(w);
+        auto neighbors = graph.neighbors(v);
+
+        // Add the current vertex to the clique along with the weight of its
+        // edges to the other vertices of the clique
+        long unsigned int R_new_weight = R_weight;
+        for (auto u : R)
+            R_new_weight += graph.weight(u, v);
+        R.push_back(v);
+
+        // Intersect P and X with the neighbors of the current vertex
+        std::vector<unsigned int> P_new;
+        std::set_intersection(P.begin(), P.end(),
+                              neighbors.begin(), neighbors.end(),
+                              std::back_inserter(P_new));
+        std::vector<unsigned int> X_new;
+        std::set_intersection(X.begin(), X.end(),
+                              neighbors.begin(), neighbors.end(),
+                              std::back_inserter(X_new));
 
         // Recursive call
-        BronKerbosch(graph, R_new, P_new, X_new, cliques);
+        BronKerbosch(graph, R, R_new_weight, P_new, X_new, visitor, rule, monitor);
+        R.pop_back();
 
         // Remove the current vertex from P and add it to X
-        P.erase(v);
-        X.insert(v);
+        P.erase(std::lower_bound(P.begin(), P.end(), v));
+        X.insert(std::lower_bound(X.begin(), X.end(), v), v);
     }
 }
 
 /**
- * @brief Finds the maximum weight clique in a graph using an exact algorithm
+ * @brief The state of a bit-parallel Bron-Kerbosch search
  *
- * This function finds the maximum weight clique in a graph by generating all
- * possible subsets of vertices and checking if they form a clique.
+ * The search keeps an explicit stack of frames instead of recursing, the frame
+ * of depth d being the node of the search where R holds d vertices. A frame
+ * holds P, X and the vertices of P left to branch on, as bitsets over the dense
+ * indices of the graph, along with the weight of R. The bitsets of every depth
+ * are stored in a single buffer allocated once, so that the search itself
+ * never allocates and its depth is not limited by the call stack.
  *
- * The time complexity of this function is O(3^(n/3) * n^2), where n is the number
- * of vertices in the graph.
+ * The current clique R is a stack of indices, reserved to the size of the
+ * graph, given to the visitor in the order its vertices were added. The frames
+ * from depth 1 to depth are on the stack, and the stack is empty when depth is
+ * 0.
+ */
+class BitParallelSearch
+{
+public:
+    BitParallelSearch(
+        const FrozenGraph &graph,
+        const BitAdjacency &adjacency,
+        const CliqueVisitor &visitor,
+        Pivot rule,
+        SearchMonitor &monitor)
+        : graph(graph),
+          adjacency(adjacency),
+          visitor(visitor),
+          rule(rule),
+          monitor(monitor),
+          words(adjacency.words()),
+          depth(0),
+          weights(graph.size() + 2, 0),
+          _buffers(3 * (static_cast<long unsigned int>(graph.size()) + 2) * words, 0)
+    {
+        R.reserve(graph.size());
+    }
+
+    // Get methods
+    inline uint64_t *P(unsigned int depth) { return _buffers.data() + (3 * depth) * words; }
+    inline uint64_t *X(unsigned int depth) { return _buffers.data() + (3 * depth + 1) * words; }
+    inline uint64_t *branches(unsigned int depth) { return _buffers.data() + (3 * depth + 2) * words; }
+
+    const FrozenGraph &graph;
+    const BitAdjacency &adjacency;
+    const CliqueVisitor &visitor;
+    Pivot rule;
+    SearchMonitor &monitor;
+    unsigned int words;
+    unsigned int depth;                     // depth of the top frame
+    std::vector<unsigned int> R;            // current clique
+    std::vector<long unsigned int> weights; // depth -> weight of R
+
+private:
+    std::vector<uint64_t> _buffers; // depth -> P, X, branches
+};
+
+/**
+ * @brief Choose the pivot vertex of a call of the Bron-Kerbosch algorithm on
+ * bitsets
  *
- * @param g The graph
+ * This is the same function as above, P and X being bitsets over the dense
+ * indices of the graph. The neighbors of a vertex in P are counted with a
+ * population count of the AND of P and its row of the bit matrix.
+ *
+ * @param adjacency The bit matrix of the graph
+ * @param P The bitset of candidate vertices, not empty
+ * @param X The bitset of excluded vertices
+ * @param rule The pivot rule
+ * @return unsigned int The pivot vertex
+ */
+inline unsigned int choosePivot(
+    const BitAdjacency &adjacency,
+    const uint64_t *P,
+    const uint64_t *X,
+    Pivot rule) // O(|P U X| * n / 64)
+{
+    unsigned int words = adjacency.words();
+
+    unsigned int pivot = 0;
+    while (!BitAdjacency::test(P, pivot))
+        pivot++;
+    if (rule == Pivot::First)
+        return pivot;
+
+    long int max_count = -1;
+    for (unsigned int i = 0; i < words; i++)
+        for (uint64_t word = P[i] | X[i]; word; word &= word - 1)
+        {
+            unsigned int u = i * WORD_BITS + __builtin_ctzll(word);
+            long int count = BitAdjacency::intersectionCount(P, adjacency.row(u), words);
+            if (count > max_count)
+            {
+                max_count = count;
+                pivot = u;
+            }
+        }
+    return pivot;
+}
+
+/**
+ * @brief Open the frame of a node of a bit-parallel Bron-Kerbosch search
+ *
+ * P and X of the node are in the buffers of its depth, which is the size of R.
+ * If P is empty, the node is a leaf: R is a maximal clique if X is empty too,
+ * and no frame is opened. Otherwise a pivot vertex is chosen and the frame is
+ * pushed, with the vertices of P that are not neighbors of the pivot to branch
+ * on.
+ *
+ * @param search The state of the search
+ * @param R_weight The weight of R
+ * @return true If a frame was opened, false for a leaf
+ */
+inline bool openFrame(BitParallelSearch &search, long unsigned int R_weight)
+{
+    search.monitor.visit();
+
+    unsigned int depth = search.R.size();
+    unsigned int words = search.words;
+    uint64_t *P = search.P(depth);
+    uint64_t *X = search.X(depth);
+    bool P_empty = !BitAdjacency::any(P, words);
+
+    // Base case : if P and X are empty, R is a maximal clique
+    if (P_empty && !BitAdjacency::any(X, words))
+        search.visitor(search.R, R_weight);
+    // If only P is empty, backtrack
+    if (P_empty)
+        return false;
+
+    // Chose a pivot vertex from P U X and branch on the vertices of P that are
+    // not its neighbors
+    unsigned int pivot = choosePivot(search.adjacency, P, X, search.rule);
+    BitAdjacency::difference(search.branches(depth), P, search.adjacency.row(pivot), words);
+
+    search.weights[depth] = R_weight;
+    search.depth = depth;
+    return true;
+}
+
+/**
+ * @brief A task of a parallel enumeration of the maximal cliques
+ *
+ * The task is either the subproblem of a vertex, R holding the vertex alone and
+ * P and X being empty, or a node split off the stack of a bit-parallel search,
+ * with its clique R, the weight of R and its bitsets P and X.
+ */
+struct EnumerationTask
+{
+    std::vector<unsigned int> R;
+    long unsigned int R_weight = 0;
+    std::vector<uint64_t> P;
+    std::vector<uint64_t> X;
+};
+
+/**
+ * @brief Give a node of a bit-parallel search to the idle workers of a pool
+ *
+ * The node is the next vertex to branch on in the lowest frame below the top
+ * one, that is the root of the biggest subtree left on the stack. It is
+ * branched on as BronKerbosch() would, but its child is pushed to the pool
+ * instead of being opened on the stack. The frames above are not changed: the
+ * vertex moved from P to X only matters to the vertices branched on after it.
+ *
+ * @param search The state of the search
+ * @param pool The pool of the enumeration
+ * @param worker The worker running the search
+ */
+void splitFrame(BitParallelSearch &search, TaskPool<EnumerationTask> &pool, unsigned int worker) // O(n / 64 + k)
+{
+    const BitAdjacency &adjacency = search.adjacency;
+    unsigned int words = search.words;
+
+    for (unsigned int depth = 1; depth < search.depth; depth++)
+    {
+        uint64_t *branches = search.branches(depth);
+        unsigned int i = 0;
+        while (i < words && !branches[i])
+            i++;
+        if (i == words)
+            continue;
+
+        unsigned int v = i * WORD_BITS + __builtin_ctzll(branches[i]);
+        BitAdjacency::reset(branches, v);
+
+        // The clique of the frame holds its depth first vertices of R
+        EnumerationTask task;
+        task.R.assign(search.R.begin(), search.R.begin() + depth);
+        task.R_weight = search.weights[depth];
+        for (auto u : task.R)
+            task.R_weight += search.graph.weight(u, v);
+        task.R.push_back(v);
+
+        task.P.resize(words);
+        task.X.resize(words);
+        BitAdjacency::intersect(task.P.data(), search.P(depth), adjacency.row(v), words);
+        BitAdjacency::intersect(task.X.data(), search.X(depth), adjacency.row(v), words);
+        BitAdjacency::reset(search.P(depth), v);
+        BitAdjacency::set(search.X(depth), v);
+
+        pool.push(worker, std::move(task));
+        return;
+    }
+}
+
+/**
+ * @brief Finds the maximal cliques in a dense frozen graph using the
+ * Bron-Kerbosch algorithm on bitsets
+ *
+ * This is the same algorithm as above, but the sets P and X are bitsets over
+ * the dense indices of the graph, so that their intersection with the
+ * neighborhood of a vertex is a word-wise AND with the bit matrix. The sets of
+ * the next depth are written in the buffers of the search instead of being
+ * allocated, as in the BBMC algorithm of San Segundo et al.
+ *
+ * The recursion is replaced by the explicit stack of the search: each step
+ * branches on the first vertex left in the top frame, whose child frame is
+ * opened, and pops the top frame once it has no vertex left. The vertex is
+ * removed from P and added to X as soon as it is branched on, which doesn't
+ * change the sets of its child since a vertex is not its own neighbor. The
+ * cliques are found in the same order as with a recursion.
+ *
+ * The search pauses between two steps when the monitor stops it or asks for a
+ * checkpoint, the stack being left as is so that the search can go on or be
+ * saved.
+ *
+ * In a parallel enumeration, a node is split off the stack for the idle
+ * workers of the pool at each step where one of them is waiting for a task.
+ *
+ * The function is compiled with and without AVX2 (see SIMD_CLONES), so that
+ * the set operations are vectorized on the CPUs that support it.
+ *
+ * @param search The state of the search
+ * @param pool The pool of a parallel enumeration, or nullptr
+ * @param worker The worker running the search in the pool
+ * @return true If the stack is empty, false if the search paused
+ */
+SIMD_CLONES bool BronKerbosch(
+    BitParallelSearch &search,
+    TaskPool<EnumerationTask> *pool = nullptr,
+    unsigned int worker = 0)
+{
+    const BitAdjacency &adjacency = search.adjacency;
+    unsigned int words = search.words;
+
+    while (search.depth > 0)
+    {
+        if (search.monitor.stopped() || search.monitor.checkpointDue())
+            return false;
+
+        if (pool != nullptr && pool->hungry())
+            splitFrame(search, *pool, worker);
+
+        unsigned int depth = search.depth;
+        uint64_t *branches = search.branches(depth);
+
+        // Pop the frame and its vertex of R once there is no vertex left
+        unsigned int i = 0;
+        while (i < words && !branches[i])
+            i++;
+        if (i == words)
+        {
+            search.R.pop_back();
+            search.depth--;
+            continue;
+        }
+
+        unsigned int v = i * WORD_BITS + __builtin_ctzll(branches[i]);
+        BitAdjacency::reset(branches, v);
+
+        // Add the current vertex to the clique along with the weight of its
+        // edges to the other vertices of the clique
+        long unsigned int R_new_weight = search.weights[depth];
+        for (auto u : search.R)
+            R_new_weight += search.graph.weight(u, v);
+
+        // Intersect P and X with the neighbors of the current vertex, then
+        // remove it from P and add it to X
+        uint64_t *P = search.P(depth);
+        uint64_t *X = search.X(depth);
+        BitAdjacency::intersect(search.P(depth + 1), P, adjacency.row(v), words);
+        BitAdjacency::intersect(search.X(depth + 1), X, adjacency.row(v), words);
+        BitAdjacency::reset(P, v);
+        BitAdjacency::set(X, v);
+
+        search.R.push_back(v);
+        if (!openFrame(search, R_new_weight))
+            search.R.pop_back();
+    }
+    return true;
+}
+
+/**
+ * @brief Enumerates the maximal cliques of a subgraph of a frozen graph whose
+ * first vertex in a degeneracy order is a given vertex
+ *
+ * R starts with the vertex alone, P holds its neighbors after it in the order
+ * and X its neighbors before it, so that each maximal clique is found by the
+ * subproblem of exactly one of its vertices (Eppstein, Löffler and Strash,
+ * 2010). P has at most d vertices, where d is the degeneracy of the subgraph.
+ *
+ * With a bit-parallel search, the subproblem is only opened: its frame is
+ * pushed on the stack of the search, which is then run by BronKerbosch().
+ *
+ * @param view The subgraph view
+ * @param positions The position of each vertex of the view in the order
+ * @param v The first vertex of the cliques
+ * @param search The state of a bit-parallel search, or nullptr to use the
+ * sorted neighbors
+ * @param visitor The function to call on each maximal clique
+ * @param rule The pivot rule
+ * @param monitor The monitor of the search, which may stop it
+ */
+void enumerateSubproblem(
+    const SubgraphView &view,
+    const std::vector<unsigned int> &positions,
+    unsigned int v,
+    BitParallelSearch *search,
+    const CliqueVisitor &visitor,
+    Pivot rule,
+    SearchMonitor &monitor) // O(d * 3^(d/3))
+{
+    const FrozenGraph &g = view.graph();
+
+    if (search != nullptr)
+    {
+        uint64_t *P = search->P(1);
+        uint64_t *X = search->X(1);
+        std::fill(P, P + search->words, 0);
+        std::fill(X, X + search->words, 0);
+        for (auto u : g.neighbors(v))
+            if (view.hasVertex(u))
+                BitAdjacency::set(positions[u] > positions[v] ? P : X, u);
+
+        search->depth = 0;
+        search->R.assign(1, v);
+        if (!openFrame(*search, 0))
+            search->R.clear();
+    }
+    else
+    {
+        // The neighbors are sorted, so are P and X
+        std::vector<unsigned int> R(1, v);
+        std::vector<unsigned int> P;
+        std::vector<unsigned int> X;
+        for (auto u : g.neighbors(v))
+            if (view.hasVertex(u))
+                (positions[u] > positions[v] ? P : X).push_back(u);
+
+        BronKerbosch(g, R, 0, P, X, visitor, rule, monitor);
+    }
+}
+
+/**
+ * @brief Enumerates the maximal cliques of a subgraph of a frozen graph, one
+ * subproblem per vertex in a degeneracy order
+ *
+ * The subproblems are independent: with a single visitor they are solved in
+ * order, and with several visitors they are the tasks of a pool of as many
+ * workers, each worker calling its own visitor. The subproblems are dealt to
+ * the workers in turn, and a bit-parallel search splits nodes off its stack
+ * whenever a worker runs out of tasks, so that a heavy subproblem is shared.
+ *
+ * With a single visitor, the search can be resumed from a checkpoint and saved
+ * when the monitor asks for it, when it stops the search and once the search is
+ * complete. The save function is given the state of the search and adds the
+ * heaviest clique found so far before saving it. The bit-parallel search is
+ * saved with its stack, while the sorted neighbors search, which recurses, is
+ * saved between two subproblems (or before the current one when it is stopped,
+ * which is then solved again).
+ *
+ * @param view The subgraph view
+ * @param visitors The function to call on each maximal clique, per worker
+ * @param options The options of the algorithm (pivot rule, engine)
+ * @param monitor The monitor of the search, which may stop it
+ * @param resumed The checkpoint to resume the search from, or nullptr
+ * @param save The function saving a checkpoint, or nullptr
+ * @throws std::runtime_error If the checkpoint is not one of this search
+ */
+void enumerateSubproblems(
+    const SubgraphView &view,
+    const std::vector<CliqueVisitor> &visitors,
+    const MEWCOptions &options,
+    SearchMonitor &monitor,
+    const Checkpoint *resumed = nullptr,
+    const std::function<void(Checkpoint &)> &save = nullptr) // O(d * n * 3^(d/3))
+{
+    const FrozenGraph &g = view.graph();
+
+    std::vector<unsigned int> order = view.degeneracyOrder(); // O(n + m)
+    std::vector<unsigned int> positions(g.size(), 0);
+    for (unsigned int i = 0; i < order.size(); i++)
+        positions[order[i]] = i;
+
+    // Use the bit matrix on dense graphs and the sorted neighbors otherwise
+    std::optional<BitAdjacency> adjacency;
+    std::vector<BitParallelSearch> searches;
+    if (options.engine == Engine::BitParallel && BitAdjacency::fits(g.size(), g.edgeCount()))
+    {
+        adjacency = g.bitAdjacency(); // O(n^2 / 64 + m)
+        searches.reserve(visitors.size());
+        for (const auto &visitor : visitors)
+            searches.emplace_back(g, adjacency.value(), visitor, options.pivot, monitor);
+    }
+    auto search = [&searches](unsigned int worker)
+    { return searches.empty() ? nullptr : &searches[worker]; };
+
+    if (visitors.size() > 1)
+    {
+        // The owner of a deque pops its newest task first, so the subproblems
+        // are pushed from the last to the first
+        unsigned int workers = visitors.size();
+        TaskPool<EnumerationTask> pool(workers);
+        for (unsigned int i = order.size(); i-- > 0;)
+            pool.push(i % workers, {{order[i]}, 0, {}, {}});
+        pool.run([&](unsigned int worker, EnumerationTask &task)
+                 {
+                     if (monitor.stopped())
+                         return;
+
+                     BitParallelSearch *s = search(worker);
+                     if (task.P.empty())
+                         enumerateSubproblem(view, positions, task.R.front(), s, visitors[worker], options.pivot, monitor);
+                     else
+                     {
+                         // Open the node split off the stack of another worker
+                         s->R.assign(task.R.begin(), task.R.end());
+                         std::copy(task.P.begin(), task.P.end(), s->P(s->R.size()));
+                         std::copy(task.X.begin(), task.X.end(), s->X(s->R.size()));
+                         s->depth = 0;
+                         if (!openFrame(*s, task.R_weight))
+                             s->R.clear();
+                     }
+                     if (s != nullptr)
+                         BronKerbosch(*s, &pool, worker);
+                 });
+        return;
+    }
+
+    // The problem the checkpoints belong to
+    Checkpoint problem;
+    problem.vertices = view.size();
+    problem.edges = g.edgeCount();
+    problem.fingerprint = Checkpoint::fingerprintOf(view);
+    problem.pivot = options.pivot;
+    problem.engine = searches.empty() ? Engine::Sparse : Engine::BitParallel;
+    problem.words = searches.empty() ? 0 : searches[0].words;
+
+    // Save the state of the search, with the stack of the bit-parallel search
+    // if it is in a subproblem
+    auto saveCheckpoint = [&](unsigned int next)
+    {
+        if (!save)
+            return;
+        Checkpoint checkpoint = problem;
+        checkpoint.next = next;
+        checkpoint.nodes = monitor.nodes();
+        if (search(0) != nullptr)
+        {
+            BitParallelSearch &s = *search(0);
+            checkpoint.R.assign(s.R.begin(), s.R.begin() + s.depth);
+            checkpoint.sets.assign(s.P(1), s.P(s.depth + 1));
+            checkpoint.weights.assign(s.weights.begin() + 1, s.weights.begin() + s.depth + 1);
+        }
+        save(checkpoint);
+        monitor.checkpointSaved();
+    };
+
+    // Restore the state of the search
+    unsigned int start = 0;
+    bool in_subproblem = false;
+    if (resumed != nullptr)
+    {
+        if (resumed->fingerprint != problem.fingerprint)
+            throw std::runtime_error("The checkpoint was saved on a different graph");
+        if (resumed->vertices != problem.vertices || resumed->edges != problem.edges ||
+            resumed->pivot != problem.pivot || resumed->engine != problem.engine ||
+            resumed->words != problem.words || resumed->next > order.size())
+            throw std::runtime_error("The checkpoint is not one of this search");
+
+        // The vertices must be in the view and the stack must fit in the
+        // buffers of the bit-parallel search, a clique being at most as large
+        // as the view
+        auto inView = [&view](unsigned int v)
+        { return v < view.graph().size() && view.hasVertex(v); };
+        if (!std::all_of(resumed->R.begin(), resumed->R.end(), inView) ||
+            !std::all_of(resumed->clique.begin(), resumed->clique.end(), inView) ||
+            resumed->R.size() > view.size() || resumed->clique.size() > view.size() ||
+            (!resumed->R.empty() && search(0) == nullptr))
+            throw std::runtime_error("The checkpoint is not one of this search");
+
+        // The bitsets must not hold bits past the last vertex of the graph
+        unsigned int tail = g.size() % 64;
+        if (problem.words > 0 && tail != 0)
+            for (long unsigned int i = problem.words - 1; i < resumed->sets.size(); i += problem.words)
+                if (resumed->sets[i] >> tail != 0)
+                    throw std::runtime_error("The checkpoint is not one of this search");
+        if (g.weight(resumed->clique) != resumed->weight)
+            throw std::runtime_error("The checkpoint is not one of this search");
+
+        start = resumed->next;
+        monitor.addNodes(resumed->nodes);
+        if (!resumed->R.empty())
+        {
+            BitParallelSearch &s = *search(0);
+            s.R = resumed->R;
+            s.depth = s.R.size();
+            std::copy(resumed->sets.begin(), resumed->sets.end(), s.P(1));
+            std::copy(resumed->weights.begin(), resumed->weights.end(), s.weights.begin() + 1);
+            in_subproblem = true;
+        }
+    }
+
+    for (unsigned int i = start; i < order.size(); i++)
+    {
+        if (monitor.stopped())
+        {
+            saveCheckpoint(i);
+            return;
+        }
+
+        if (!in_subproblem)
+            enumerateSubproblem(view, positions, order[i], search(0), visitors[0], options.pivot, monitor);
+        in_subproblem = false;
+
+        // Run the bit-parallel search, saving it each time it pauses
+        if (search(0) != nullptr)
+            while (!BronKerbosch(*search(0)))
+            {
+                saveCheckpoint(i);
+                if (monitor.stopped())
+                    return;
+            }
+        else if (monitor.stopped())
+        {
+            saveCheckpoint(i);
+            return;
+        }
+
+        if (monitor.checkpointDue())
+            saveCheckpoint(i + 1);
+    }
+    saveCheckpoint(order.size());
+}
+
+/**
+ * @brief Enumerates the maximal cliques of a subgraph of a frozen graph
+ *
+ * Each maximal clique is given to the visitor with its weight as soon as it is
+ * found, nothing is stored per clique. The clique given to the visitor is the
+ * current clique of the search, in the order its vertices were added, and is
+ * only valid during the call.
+ *
+ * The excluded vertices are never put in P, so they can't enter R or X.
+ *
+ * The time complexity of this function is O(d * n * 3^(d/3)), where n is the
+ * number of vertices in the graph and d its degeneracy.
+ *
+ * @param view The subgraph view
+ * @param visitor The function to call on each maximal clique
+ * @param options The options of the algorithm (pivot rule, engine, time limit,
+ * progress)
+ */
+void enumerateMaximalCliques(const SubgraphView &view, const CliqueVisitor &visitor, const MEWCOptions &options)
+{
+    SearchMonitor monitor("enumerate", options.timeLimit, options.progress);
+    enumerateSubproblems(view, {visitor}, options, monitor); // O(d * n * 3^(d/3))
+    monitor.report();
+}
+
+/**
+ * @brief Finds the maximum weight clique in a subgraph of a frozen graph using
+ * an exact algorithm
+ *
+ * The maximal cliques are enumerated and only the heaviest one is kept, so the
+ * memory used is bounded by the size of the graph. With several threads, each
+ * worker keeps its heaviest clique and the heaviest of them is returned.
+ *
+ * With a time limit, the heaviest clique found when the limit is reached is
+ * returned, without proof that it is the maximum one.
+ *
+ * With a checkpoint file, the state of the search and the heaviest clique found
+ * so far are saved to it periodically, when the time limit is reached and once
+ * the search is complete, and the search can be resumed from it. Checkpoints
+ * are only supported by a single thread, so the other threads are not used.
+ *
+ * The time complexity of this function is O(d * n * 3^(d/3)), where n is the
+ * number of vertices in the graph and d its degeneracy.
+ *
+ * @param view The subgraph view
+ * @param options The options of the algorithm (pivot rule, engine, threads,
+ * time limit, progress, checkpoint, resume, shared monitor)
  * @return The maximum weight clique
+ * @throws std::runtime_error If the checkpoint can't be read or written
  */
-Clique exactMEWC(const Graph &g)
+Clique exactMEWC(const SubgraphView &view, const MEWCOptions &options)
 {
-    // variable to store the maximum weight clique
-    Clique max_clique;
-
-    // get all the maximal cliques in the graph
-    Clique R;
-    std::unordered_set<VertexPtr> P = g.vertices();
-    std::unordered_set<VertexPtr> X;
-    std::vector<Clique> cliques;       // vector to store the maximal cliques
-    BronKerbosch(g, R, P, X, cliques); // O(3^(n/3))
-
-    // iterate over all maximal cliques
-    for (auto clique : cliques) // O(3^(n/3))
+    bool checkpoints = !options.checkpoint.empty() || !options.resume.empty();
+    unsigned int threads = checkpoints ? 1 : options.threads;
+
+    SearchMonitor own_monitor("exact", options.timeLimit, options.progress,
+                              options.checkpoint.empty() ? 0 : options.checkpointInterval);
+    SearchMonitor &monitor = options.monitor != nullptr ? *options.monitor : own_monitor;
+    std::vector<std::vector<unsigned int>> max_cliques(threads);
+    std::vector<long unsigned int> max_weights(threads, 0);
+
+    // Start from the heaviest clique of the checkpoint
+    Checkpoint resumed;
+    if (!options.resume.empty())
     {
-        // if the clique is a clique and has a higher weight than the current
-        // maximum weight clique, set the maximum weight clique to the current clique
-        if (clique.weight(g) >= max_clique.weight(g))
-            max_clique = clique;
+        resumed = Checkpoint::load(options.resume);
+        max_cliques[0] = resumed.clique;
+        max_weights[0] = resumed.weight;
+        if (!resumed.clique.empty())
+            monitor.improveIncumbent(resumed.weight);
     }
 
-    // return the maximum clique
-    return max_clique;
+    // Keep the heaviest maximal clique of each worker
+    std::vector<CliqueVisitor> visitors;
+    for (unsigned int worker = 0; worker < threads; worker++)
+        visitors.push_back([&max_cliques, &max_weights, &monitor, worker](const std::vector<unsigned int> &clique, long unsigned int weight)
+                           {
+                               if (weight >= max_weights[worker])
+                               {
+                                   max_cliques[worker] = clique;
+                                   max_weights[worker] = weight;
+                                   monitor.improveIncumbent(weight);
+                               }
+                           });
+
+    // Save the heaviest clique along with the state of the search
+    std::function<void(Checkpoint &)> save;
+    if (!options.checkpoint.empty())
+        save = [&](Checkpoint &checkpoint)
+        {
+            checkpoint.clique = max_cliques[0];
+            checkpoint.weight = max_weights[0];
+            checkpoint.save(options.checkpoint);
+        };
+
+    enumerateSubproblems(view, visitors, options, monitor, options.resume.empty() ? nullptr : &resumed, save); // O(d * n * 3^(d/3))
+    if (options.monitor == nullptr)
+        monitor.report();
+
+    auto heaviest = std::max_element(max_weights.begin(), max_weights.end()) - max_weights.begin();
+    return view.graph().clique(max_cliques[heaviest]);
+}
+
+/**
+ * @brief Finds the maximum weight clique in a frozen graph using an exact
+ * algorithm
+ *
+ * @param g The frozen graph
+ * @param options The options of the algorithm (pivot rule, engine, threads,
+ * time limit, progress, checkpoint, resume)
+ * @return The maximum weight clique
+ */
+Clique exactMEWC(const FrozenGraph &g, const MEWCOptions &options)
+{
+    return exactMEWC(SubgraphView(g), options);
 }
\ No newline at end of file
@@ -7,6 +7,8 @@
  * @date 2022-12-30
  */
 
+#include <algorithm>
+#include <iterator>
 #include <random>
 
 #include "mewc.hpp"
@@ -18,20 +20,17 @@
 /**
  * @brief Returns the sum of the adjacent edges of a vertex
  *
+ * This is the weighted degree of the vertex, which is cached by the graph.
+ *
  * @param graph The graph
  * @param vertex The vertex to consider
  * @return long unsigned int The sum of the adjacent edges of a vertex
  */
 long unsigned int getSumAdjacentEdges(
     const Graph &graph,
-    const VertexPtr &vertex) // O(n)
+    VertexId vertex) // O(1)
 {
-    long unsigned int sum = 0;
-    auto adjMatrix = graph.adjacencyMatrix();
-    auto neighbors = adjMatrix[vertex->id()];
-    for (const auto &[neighbor, edge] : neighbors)
-        sum += edge->weight();
-    return sum;
+    return graph.weightedDegree(vertex);
 }
 
 /**
@@ -43,10 +42,9 @@ long unsigned int getSumAdjacentEdges(
  */
 long unsigned int getGamma(
     const Graph &graph,
-    const std::unordered_set<VertexPtr> &vertices) // O(n^2)
+    const std::unordered_set<VertexId> &vertices) // O(n)
 {
     long unsigned int gamma = 0;
-    auto adjMatrix = graph.adjacencyMatrix();
     for (auto vertex : vertices)
     {
         long unsigned int weight = getSumAdjacentEdges(graph, vertex);
@@ -61,14 +59,14 @@ long unsigned int getGamma(
  *
  * @param graph The graph
  * @param vertices The vertices to consider
- * @return std::vector<VertexPtr> The Restricted Candidate List
+ * @return std::vector<VertexId> The Restricted Candidate List
  */
-std::vector<VertexPtr> MakeRCL(
+std::vector<VertexId> MakeRCL(
     const Graph &graph,
-    const std::unordered_set<VertexPtr> &vertices) // O(n^2)
+    const std::unordered_set<VertexId> &vertices) // O(n)
 {
     long unsigned int gamma = getGamma(graph, vertices);
-    std::vector<VertexPtr> RCL;
+    std::vector<VertexId> RCL;
     for (auto vertex : vertices)
     {
         long unsigned int weight = getSumAdjacentEdges(graph, vertex);
@@ -81,10 +79,12 @@ std::vector<VertexPtr> MakeRCL(
 /**
  * @brief Select a vertex inside the Restricted Candidate List randomly
  *
- * @param std::vector<VertexPtr> RCL
- * @return std::vector<VertexPtr> The vertex choose randomly
+ * The vertices are either ids of a Graph or indices of a FrozenGraph.
+ *
+ * @param std::vector<unsigned int> RCL
+ * @return unsigned int The vertex choose randomly
  */
-VertexPtr SelectElementAtRandom(const std::vector<VertexPtr> &RCL) // O(1)
+unsigned int SelectElementAtRandom(const std::vector<unsigned int> &RCL) // O(1)
 {
     std::random_device rd;
     std::mt19937 gen(rd());
@@ -97,22 +97,27 @@ VertexPtr SelectElementAtRandom(const std::vector<VertexPtr> &RCL) // O(1)
  * neighbors from the set
  *
  * @param Graph graph
- * @param VertexPtr vertex
- * @param std::unordered_set<VertexPtr> &P
+ * @param VertexId vertex
+ * @param std::unordered_set<VertexId> &P
  */
 void AdaptGreedyFunction(
     const Graph &graph,
-    const VertexPtr &vertex,
-    std::unordered_set<VertexPtr> &P) // O(n)
+    VertexId vertex,
+    std::unordered_set<VertexId> &P) // O(n)
 {
-    auto adjMatrix = graph.adjacencyMatrix();
-    auto adjList = adjMatrix[vertex->id()];
-    auto P_copy = P;
+    const auto &adjList = graph.neighbors(vertex);
+
+    // Remove Vertex from the set of vertices to consider, even if it is its
+    // own neighbor through a self-loop
+    P.erase(vertex);
 
-    P.erase(vertex); // Remove Vertex from the set of vertices to consider
-    for (const auto &v : P_copy)
-        if (adjList.find(v->id()) == adjList.end())
-            P.erase(v); // Remove Vertex's neighbors from the set of vertices to consider
+    // Remove the vertices that are not its neighbors from the set of vertices
+    // to consider
+    for (auto it = P.begin(); it != P.end();)
+        if (adjList.find(*it) == adjList.end())
+            it = P.erase(it);
+        else
+            ++it;
 }
 
 /**
@@ -124,13 +129,15 @@ void AdaptGreedyFunction(
 Clique ConstructGreedyRandomizedSolution(const Graph &graph) // O(n^3)
 {
     Clique Solution;
-    std::unordered_set<VertexPtr> P = graph.vertices();
+    std::unordered_set<VertexId> P;
+    for (auto v : graph.vertices())
+        P.insert(v);
 
     while (!P.empty())
     {
-        std::vector<VertexPtr> RCL = MakeRCL(graph, P); // Restricted Candidate List
-        VertexPtr s = SelectElementAtRandom(RCL);
-        Solution.addVertex(s); // Add Vertex to the solution we create
+        std::vector<VertexId> RCL = MakeRCL(graph, P); // Restricted Candidate List
+        VertexId s = SelectElementAtRandom(RCL);
+        Solution.addVertex(s, graph); // Add Vertex to the solution we create
         AdaptGreedyFunction(graph, s, P);
     }
 
@@ -140,29 +147,31 @@ Clique ConstructGreedyRandomizedSolution(const Graph &graph) // O(n^3)
 /**
  * @brief Get all the k-tuples of a set of vertices
  *
- * @param std::unordered_set<VertexPtr> vertices
- * @param std::vector<std::vector<VertexPtr>> &kTuples
- * @param std::unordered_set<VertexPtr>::iterator iter
+ * The vertices are either ids of a Graph or indices of a FrozenGraph.
+ *
+ * @param std::vector<unsigned int> vertices
+ * @param std::vector<std::vector<unsigned int>> &kTuples
+ * @param long unsigned int first The position of the first vertex to consider
  * @param int k
- * @param std::vector<VertexPtr> tuple
+ * @param std::vector<unsigned int> tuple
  */
 void getKTuples(
-    const std::unordered_set<VertexPtr> &vertices,
-    std::vector<std::vector<VertexPtr>> &kTuples,
-    const std::unordered_set<VertexPtr>::iterator &iter,
+    const std::vector<unsigned int> &vertices,
+    std::vector<std::vector<unsigned int>> &kTuples,
+    long unsigned int first = 0,
     const unsigned int k = TUPLE_SIZE,
-    std::vector<VertexPtr> tuple = {}) // O(k^n)
+    std::vector<unsigned int> tuple = {}) // O(k^n)
 {
     if (k == 0 || k > vertices.size())
         return;
 
-    for (auto it = iter; it != vertices.end(); ++it)
+    for (long unsigned int i = first; i < vertices.size(); i++)
     {
-        tuple.push_back(*it);
+        tuple.push_back(vertices[i]);
         if (k == 1)
             kTuples.push_back(tuple);
         else
-            getKTuples(vertices, kTuples, std::next(it), k - 1, tuple);
+            getKTuples(vertices, kTuples, i + 1, k - 1, tuple);
         tuple.pop_back();
     }
 }
@@ -170,21 +179,24 @@ void getKTuples(
 /**
  * @brief Adapted local search algorithm for the GRASP MEWC algorithm
  *
+ * The subgraph of each k-tuple is a view of the frozen graph without the
+ * vertices of the tuple instead of a copy of the graph.
+ *
  * @param Graph graph
+ * @param SubgraphView view The view of the whole graph, frozen once by the caller
  * @param Clique Solution
  * @return Clique The solution after the local search if it is better
  */
-Clique LocalSearchGrasp(const Graph &graph, Clique Solution)
+Clique LocalSearchGrasp(const Graph &graph, const SubgraphView &view, Clique Solution)
 {
-    auto vertices = Solution.vertices();
-    std::vector<std::vector<VertexPtr>> kTuples;
-    getKTuples(vertices, kTuples, vertices.begin()); // There is k^(n-1) k-tuples of n vertices
+    std::vector<std::vector<VertexId>> kTuples;
+    getKTuples(Solution.ids(), kTuples); // There is k^(n-1) k-tuples of n vertices
 
-    for (auto tuple : kTuples) // O(k^n)
+    for (const auto &tuple : kTuples) // O(k^n)
     {
-        Graph subgraph = graph;
+        SubgraphView subgraph = view; // O(n / 64)
         for (auto vertex : tuple)
-            subgraph.removeVertex(vertex);
+            subgraph.exclude(view.graph().index(vertex).value());
 
         Clique subSolution = localSearchMEWC(subgraph);
 
@@ -210,6 +222,8 @@ void UpdateSolution(const Graph &graph, Clique &Solution, Clique &BestSolution)
 /**
  * @brief The grasp MEWC algorithm
  *
+ * The graph is frozen once for the local searches of all the retries.
+ *
  * @param Graph g
  * @return Clique The best solution the GRASP can find
  */
@@ -218,12 +232,180 @@ Clique graspMEWC(const Graph &g)
     Clique BestSolution;
     Clique Solution;
 
+    FrozenGraph frozen(g); // O(n + m log m)
+    SubgraphView view(frozen);
+
     for (unsigned short int i = 0; i < RETRIES; i++)
     {
         Solution = ConstructGreedyRandomizedSolution(g); // O(n^3)
-        Solution = LocalSearchGrasp(g, Solution);
+        Solution = LocalSearchGrasp(g, view, Solution);
         UpdateSolution(g, Solution, BestSolution); // O(1)
     }
 
     return BestSolution;
+}
+
+/**
+ * @brief Returns the sum of the adjacent edges of each vertex of a subgraph
+ * view
+ *
+ * The sums are computed once per view, so that building a Restricted Candidate
+ * List only looks them up.
+ *
+ * @param view The subgraph view
+ * @return std::vector<long unsigned int> The sum of the adjacent edges of each
+ * vertex, by index
+ */
+std::vector<long unsigned int> getSumsAdjacentEdges(const SubgraphView &view) // O(n) or O(m)
+{
+    std::vector<long unsigned int> sums(view.graph().size(), 0);
+    for (auto vertex : view.vertices())
+        sums[vertex] = view.weightedDegree(vertex);
+    return sums;
+}
+
+/**
+ * @brief Create the Restricted Candidate List from the vertices of a subgraph
+ * view
+ *
+ * @param sums The sum of the adjacent edges of each vertex of the view
+ * @param vertices The indices of the vertices to consider
+ * @return std::vector<unsigned int> The Restricted Candidate List
+ */
+std::vector<unsigned int> MakeRCL(
+    const std::vector<long unsigned int> &sums,
+    const std::vector<unsigned int> &vertices) // O(|P|)
+{
+    long unsigned int gamma = 0;
+    for (auto vertex : vertices)
+        gamma = std::max(gamma, sums[vertex]);
+
+    std::vector<unsigned int> RCL;
+    for (auto vertex : vertices)
+        if (sums[vertex] > gamma / (1 + ALPHA))
+            RCL.push_back(vertex);
+    return RCL;
+}
+
+/**
+ * @brief Adapt the set of vertices to consider by keeping only the neighbors
+ * of a vertex of a frozen graph
+ *
+ * @param FrozenGraph graph
+ * @param unsigned int vertex
+ * @param std::vector<unsigned int> &P The sorted indices of the vertices
+ */
+void AdaptGreedyFunction(
+    const FrozenGraph &graph,
+    unsigned int vertex,
+    std::vector<unsigned int> &P) // O(n)
+{
+    std::vector<unsigned int> new_P;
+    auto neighbors = graph.neighbors(vertex);
+    std::set_intersection(P.begin(), P.end(),
+                          neighbors.begin(), neighbors.end(),
+                          std::back_inserter(new_P));
+    P.swap(new_P);
+}
+
+/**
+ * @brief Construct a random clique of a subgraph view
+ *
+ * @param SubgraphView view
+ * @param sums The sum of the adjacent edges of each vertex of the view
+ * @return std::vector<unsigned int> The indices of the clique we create
+ */
+std::vector<unsigned int> ConstructGreedyRandomizedSolution(
+    const SubgraphView &view,
+    const std::vector<long unsigned int> &sums) // O(n^2)
+{
+    std::vector<unsigned int> Solution;
+    std::vector<unsigned int> P = view.vertices();
+
+    while (!P.empty())
+    {
+        std::vector<unsigned int> RCL = MakeRCL(sums, P); // Restricted Candidate List
+        unsigned int s = SelectElementAtRandom(RCL);
+        Solution.push_back(s); // Add Vertex to the solution we create
+        AdaptGreedyFunction(view.graph(), s, P);
+    }
+
+    return Solution;
+}
+
+/**
+ * @brief Adapted local search algorithm for the GRASP MEWC algorithm on a
+ * subgraph view
+ *
+ * @param SubgraphView view
+ * @param std::vector<unsigned int> Solution
+ * @return std::vector<unsigned int> The solution after the local search if it is better
+ */
+std::vector<unsigned int> LocalSearchGrasp(const SubgraphView &view, std::vector<unsigned int> Solution)
+{
+    const FrozenGraph &graph = view.graph();
+
+    std::vector<std::vector<unsigned int>> kTuples;
+    getKTuples(Solution, kTuples); // There is k^(n-1) k-tuples of n vertices
+
+    long unsigned int weight = graph.weight(Solution);
+    for (const auto &tuple : kTuples) // O(k^n)
+    {
+        SubgraphView subgraph = view; // O(n / 64)
+        for (auto vertex : tuple)
+            subgraph.exclude(vertex);
+
+        // The subgraph shares the indices of the graph
+        std::vector<unsigned int> subSolution = graph.indices(localSearchMEWC(subgraph));
+        long unsigned int subWeight = graph.weight(subSolution);
+
+        if (subWeight > weight)
+        {
+            Solution = subSolution;
+            weight = subWeight;
+        }
+    }
+
+    return Solution;
+}
+
+/**
+ * @brief The grasp MEWC algorithm on a subgraph view
+ *
+ * @param SubgraphView view
+ * @return Clique The best solution the GRASP can find
+ */
+Clique graspMEWC(const SubgraphView &view)
+{
+    const FrozenGraph &g = view.graph();
+
+    std::vector<unsigned int> BestSolution;
+    long unsigned int BestWeight = 0;
+    std::vector<long unsigned int> sums = getSumsAdjacentEdges(view); // O(n) or O(m)
+
+    for (unsigned short int i = 0; i < RETRIES; i++)
+    {
+        std::vector<unsigned int> Solution = ConstructGreedyRandomizedSolution(view, sums); // O(n^2)
+        Solution = LocalSearchGrasp(view, Solution);
+
+        long unsigned int weight = g.weight(Solution);
+        if (weight > BestWeight)
+        {
+            BestSolution = Solution;
+            BestWeight = weight;
+        }
+    }
+
+    return g.clique(BestSolution);
+}
+
+/**
+ * @brief The grasp MEWC algorithm on a frozen graph
+ *
+ * @param FrozenGraph g
+ * @return Clique The best solution the GRASP can find
+ */
+Clique graspMEWC(const FrozenGraph &g)
+{
+    return graspMEWC(SubgraphView(g));
 }
\ No newline at end of file
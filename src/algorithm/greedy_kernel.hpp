@@ -0,0 +1,179 @@
+/**
+ * @file greedy_kernel.hpp
+ * @brief Declaration and implementation of the greedy construction kernel and
+ * of its scoring policies
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <utility>
+#include <vector>
+
+#include "../model/frozen_graph.hpp"
+#include "../model/indexed_heap.hpp"
+#include "../model/subgraph_view.hpp"
+
+#ifndef GREEDY_KERNEL_HPP
+#define GREEDY_KERNEL_HPP
+
+/*
+ * A scoring policy tells the greedy kernel which candidate to add next to the
+ * clique. It is built from the view the kernel runs on, and provides:
+ * - Key: the type of the scores, compared with operator<, the highest being
+ *   added first (pairs break the ties of their first member),
+ * - dynamic: whether the score depends on the gain of the candidate, that is
+ *   the sum of the weights of its edges to the clique,
+ * - key(v, gain): the score of a candidate given its gain.
+ *
+ * The kernel is instantiated with each policy, so key() is inlined in its loop.
+ */
+
+// Degree of each vertex in a view, by index
+inline std::vector<unsigned int> viewDegrees(const SubgraphView &view) // O(m)
+{
+    std::vector<unsigned int> degrees(view.graph().size(), 0);
+    for (auto v : view.vertices())
+        degrees[v] = view.degree(v);
+    return degrees;
+}
+
+// Sum of the weights of the edges of each vertex in a view, by index
+inline std::vector<long unsigned int> viewWeightedDegrees(const SubgraphView &view) // O(m)
+{
+    std::vector<long unsigned int> weights(view.graph().size(), 0);
+    for (auto v : view.vertices())
+        weights[v] = view.weightedDegree(v);
+    return weights;
+}
+
+// The candidate with the highest degree
+struct DegreeScore
+{
+    typedef unsigned int Key;
+    static constexpr bool dynamic = false;
+
+    DegreeScore(const SubgraphView &view) : degrees(viewDegrees(view)) {}
+    inline Key key(unsigned int v, long unsigned int) const { return degrees[v]; }
+
+    std::vector<unsigned int> degrees;
+};
+
+// The candidate with the highest sum of edge weights
+struct WeightedDegreeScore
+{
+    typedef long unsigned int Key;
+    static constexpr bool dynamic = false;
+
+    WeightedDegreeScore(const SubgraphView &view) : weights(viewWeightedDegrees(view)) {}
+    inline Key key(unsigned int v, long unsigned int) const { return weights[v]; }
+
+    std::vector<long unsigned int> weights;
+};
+
+// The candidate with the highest gain, then the highest sum of edge weights
+struct GainScore
+{
+    typedef std::pair<long unsigned int, long unsigned int> Key;
+    static constexpr bool dynamic = true;
+
+    GainScore(const SubgraphView &view) : weights(viewWeightedDegrees(view)) {}
+    inline Key key(unsigned int v, long unsigned int gain) const { return {gain, weights[v]}; }
+
+    std::vector<long unsigned int> weights;
+};
+
+// The candidate with the highest gain, then the highest degree
+struct GainDegreeScore
+{
+    typedef std::pair<long unsigned int, unsigned int> Key;
+    static constexpr bool dynamic = true;
+
+    GainDegreeScore(const SubgraphView &view) : degrees(viewDegrees(view)) {}
+    inline Key key(unsigned int v, long unsigned int gain) const { return {gain, degrees[v]}; }
+
+    std::vector<unsigned int> degrees;
+};
+
+// The candidate with the highest degree, then the highest sum of edge weights
+struct DegreeWeightScore
+{
+    typedef std::pair<unsigned int, long unsigned int> Key;
+    static constexpr bool dynamic = false;
+
+    DegreeWeightScore(const SubgraphView &view) : degrees(viewDegrees(view)), weights(viewWeightedDegrees(view)) {}
+    inline Key key(unsigned int v, long unsigned int) const { return {degrees[v], weights[v]}; }
+
+    std::vector<unsigned int> degrees;
+    std::vector<long unsigned int> weights;
+};
+
+/**
+ * @brief Build a clique greedily in a subgraph of a frozen graph
+ *
+ * The candidate with the highest score is added to the clique until there is
+ * no candidate left, the ties being broken by the lowest index. The candidates
+ * are kept in an IndexedMaxHeap: when a vertex is added, the gains of its
+ * neighbors are increased in place (for the dynamic policies only) and the
+ * other candidates are evicted, so every edge and every vertex is handled at
+ * most once.
+ *
+ * @tparam Score The scoring policy
+ * @param view The subgraph view
+ * @return std::vector<unsigned int> The indices of the vertices of the clique
+ */
+template <typename Score>
+std::vector<unsigned int> greedyClique(const SubgraphView &view) // O(n + m log n)
+{
+    const FrozenGraph &g = view.graph();
+    const Score score(view); // O(m)
+
+    // LaTeX : $P \gets V$
+    IndexedMaxHeap<typename Score::Key> P(g.size());
+    for (auto v : view.vertices())
+        P.push(v, score.key(v, 0)); // O(n log n)
+
+    std::vector<unsigned int> clique;
+    std::vector<unsigned int> evicted;
+    evicted.reserve(P.size());
+    std::vector<long unsigned int> gains(Score::dynamic ? g.size() : 0, 0);
+    std::vector<unsigned int> marks(g.size(), 0); // last step at which each vertex was a neighbor
+    unsigned int step = 0;
+    while (!P.empty())
+    {
+        // LaTeX : v \gets \argmax_{v \in P} score(v)
+        unsigned int newVertex = P.top();
+        P.pop();
+        clique.push_back(newVertex);
+        step++;
+
+        // Mark the neighbors of the new vertex, adding the weight of their
+        // edge to it to their gains
+        auto neighbors = g.neighbors(newVertex);
+        auto weights = g.weights(newVertex);
+        for (long unsigned int i = 0; i < neighbors.size(); i++)
+        {
+            unsigned int u = neighbors[i];
+            if (!P.contains(u))
+                continue;
+            marks[u] = step;
+            if constexpr (Score::dynamic)
+            {
+                gains[u] += weights[i];
+                P.increase(u, score.key(u, gains[u]));
+            }
+        }
+
+        // LaTeX : P \gets P \cap \N(v)
+        evicted.clear();
+        for (auto u : P.items())
+            if (marks[u] != step)
+                evicted.push_back(u);
+        for (auto u : evicted)
+            P.remove(u);
+    }
+
+    return clique;
+}
+
+#endif // GREEDY_KERNEL_HPP
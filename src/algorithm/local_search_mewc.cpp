@@ -6,6 +6,10 @@
  * @date 2022-12-30
  */
 
+#include <algorithm>
+#include <limits>
+#include <optional>
+
 #include "mewc.hpp"
 
 using namespace std;
@@ -28,9 +32,9 @@ using namespace std;
  * @return The weight improvement if the clique has been improved, 0 otherwise
  */
 unsigned int improveClique(
-    Graph g,
+    const Graph &g,
     Clique *clique,
-    std::unordered_set<VertexPtr> banned_vertices = std::unordered_set<VertexPtr>(),
+    std::unordered_set<VertexId> banned_vertices = std::unordered_set<VertexId>(),
     unsigned int min_weight = 0,
     unsigned int actual_weight_improvement = 0)
 {
@@ -38,16 +42,13 @@ unsigned int improveClique(
         return 0;
 
     // Copy the initial clique
-    Clique clique2;
-    auto cv = clique->vertices();
-    for (auto clique_vertex : cv) // O(n)
-        clique2.addVertex(clique_vertex);
+    Clique clique2 = *clique; // O(n)
+    const auto &clique_vertices = clique->ids();
 
-    auto vertices = g.vertices();
-    auto v = *(clique->vertices().begin());    // a random vertex in the clique
+    const auto &vertices = g.vertices();
+    VertexId v = clique_vertices.front(); // a random vertex in the clique
     unsigned int weight_improvement = 0;       // the weight improvement that can be done to this clique by adding a vertex in this iteration
     unsigned int total_weight_improvement = 0; // the weight_improvement by adding a vertex in this iteration + the other that comes after
-    VertexPtr improvement_vertex = nullptr;    // the vertex that improves the weight of the clique
 
     // Try to find a vertex which is not in the clique but
     // which has all the vertices of the clique as neighbours
@@ -60,31 +61,15 @@ unsigned int improveClique(
         // If we have an edge between the vertex and the random vertex of the clique
         if (g.hasEdge(v, vertex))
         {
-            auto clique_vertices = clique->vertices();
-            bool valid = true;
+            // See if the vertex is adjacent to all vertices of the clique and
+            // get the weight improvement when adding it to the clique
+            auto gain = clique->gain(vertex, g); // O(n)
 
-            // See if the vertex is adjacent to all vertices of the clique
-            for (auto clique_vertex : clique_vertices) // O(n)
+            // If there is a gain, all vertices in the clique are adjacent of the vertex
+            if (gain)
             {
-                if (vertex->id() == clique_vertex->id())
-                    continue;
-
-                // If we don't have an edge between the vertex and one of the clique
-                if (!g.hasEdge(clique_vertex, vertex))
-                    valid = false;
-            }
-            // If valid = true, all vertices in the clique are adjacent of the vertex
-            if (valid)
-            {
-                // Calculated the weight improvement when adding this vertex to the clique
-                for (auto clique_vertex : clique_vertices) // O(n)
-                {
-                    if (clique_vertex == vertex)
-                        continue;
-
-                    weight_improvement += g.getEdge(clique_vertex, vertex).value()->weight();
-                }
-                clique2.addVertex(vertex);
+                weight_improvement += gain.value();
+                clique2.addVertex(vertex, g);
 
                 // See if we can improve more the clique
                 total_weight_improvement = weight_improvement + improveClique(
@@ -132,61 +117,40 @@ unsigned int improveClique(
  * @param g The graph to find the maximal clique in
  * @return The maximal clique found
  */
-Clique findInitialSolution(Graph g)
+Clique findInitialSolution(const Graph &g)
 {
     if (g.vertices().size() < 2)
         return Clique();
 
-    auto adjacency_matrix = g.adjacencyMatrix();
-    unsigned int max_degree = 0;                                     // the maximum vertex degree in the graph
-    unsigned int max_vertex = 0;                                     // the vertex of maximum degree in the graph
-    std::unordered_map<unsigned int, unsigned int> vertices_degrees; // the degrees of all vertices
-
-    // For all vertices
-    for (unsigned int i = 1; i <= adjacency_matrix.size(); i++) // O(n)
-    {
-        // the degree of the vertex i
-        auto degree = adjacency_matrix[i].size();
-        vertices_degrees[i] = degree;
+    // The vertex of maximum degree is the first one of the cached order
+    unsigned int max_vertex = g.verticesByDegree().front(); // the vertex of maximum degree in the graph
+    unsigned int max_degree = g.degree(max_vertex);         // the maximum vertex degree in the graph
 
-        // If the degree of this vertex is better than the actual max degree
-        // modify the max degree and the max vertex
-        if (degree > max_degree)
-        {
-            max_degree = degree;
-            max_vertex = i;
-        }
-    }
+    // Without any edge, there is no clique to start with
+    if (max_degree == 0)
+        return Clique();
 
-    auto vertices = g.vertices();
     unsigned int max_degree2 = 0; // the second maximum vertex degree in the graph
     unsigned int max_vertex2 = 0; // the second vertex of maximum degree in the graph
 
-    // For all vertices as candidates
-    for (auto vertex : vertices) // O(n)
+    // For all the neighbours of the max vertex as candidates
+    for (const auto &[neighbor, _] : g.neighbors(max_vertex)) // O(n)
     {
-        if (vertex->id() == max_vertex)
-            continue;
-
-        // If I have an edge between the max vertex and the candidate
-        if (g.hasEdge(vertex->id(), max_vertex))
+        // If the degree of the candidate is higher than the max degree, replace it
+        if (g.degree(neighbor) > max_degree2)
         {
-            // If the degree of the candidate is higher than the max degree, replace it
-            if (vertices_degrees[vertex->id()] > max_degree2)
-            {
-                max_degree2 = vertices_degrees[vertex->id()];
-                max_vertex2 = vertex->id();
-            }
+            max_degree2 = g.degree(neighbor);
+            max_vertex2 = neighbor;
         }
     }
 
     // Create a clique with the vertex of max degree and its neighbour of max degree
     Clique clique;
-    clique.addVertex(g.getVertex(max_vertex).value());
-    clique.addVertex(g.getVertex(max_vertex2).value());
+    clique.addVertex(max_vertex);
+    clique.addVertex(max_vertex2);
 
     // Get a full clique based on these two vertices
-    improveClique(g, &clique, std::unordered_set<VertexPtr>(), 0, 0); // O(n^3)
+    improveClique(g, &clique, std::unordered_set<VertexId>(), 0, 0); // O(n^3)
 
     return clique;
 }
@@ -205,12 +169,12 @@ Clique findInitialSolution(Graph g)
  * @param tested_vertices The set of vertices that will not be tested
  * @return The max clique found by removing the vertex if it is better, the original one otherwise
  */
-Clique findNeighbor(Graph g, Clique init_clique, std::unordered_set<VertexPtr> *tested_vertices)
+Clique findNeighbor(const Graph &g, const Clique &init_clique, std::unordered_set<VertexId> *tested_vertices)
 {
-    auto clique_vertices = init_clique.vertices();
+    const auto &clique_vertices = init_clique.ids();
     // minimum weight added by a vertex in the clique
     unsigned int min_weight = clique_vertices.size() * 101; // edge weight is less than 100 so the weight of the edges of a vertex in the clique is less than 101 times the number of vertices in the clique
-    VertexPtr min_weight_vertex = nullptr;                  // vertex that adds the minimum weight in the clique
+    std::optional<VertexId> min_weight_vertex;              // vertex that adds the minimum weight in the clique
 
     // For all vertices in the clique
     for (auto clique_vertex : clique_vertices) // O(n²)
@@ -228,7 +192,7 @@ Clique findNeighbor(Graph g, Clique init_clique, std::unordered_set<VertexPtr> *
                 continue;
 
             // Get the weight between the vertex and all its neighbours in the clique
-            weight += g.getEdge(clique_vertex, clique_vertex2).value()->weight();
+            weight += g.weight(clique_vertex, clique_vertex2);
         }
 
         // If the weight added by this vertex is less than the current minimum, modify it
@@ -240,29 +204,23 @@ Clique findNeighbor(Graph g, Clique init_clique, std::unordered_set<VertexPtr> *
     }
 
     // If no improvements have been made, this means that all possibilities have been tested, so we return the original clique
-    if (min_weight_vertex == nullptr)
+    if (!min_weight_vertex)
         return init_clique;
 
     // If I have a vertex to remove, create a new clique which is a
     // copy of the original with the tested vertex removed
-    Clique new_clique;
-    for (auto clique_vertex : clique_vertices) // O(n)
-    {
-        if (clique_vertex == min_weight_vertex)
-            continue;
-
-        new_clique.addVertex(clique_vertex);
-    }
+    Clique new_clique = init_clique;
+    new_clique.removeVertex(*min_weight_vertex, g); // O(n)
 
     // Put the tested vertex as banned
-    std::unordered_set<VertexPtr> banned_vertices;
-    banned_vertices.insert(min_weight_vertex);
+    std::unordered_set<VertexId> banned_vertices;
+    banned_vertices.insert(*min_weight_vertex);
     unsigned int improvement = improveClique(g, &new_clique, banned_vertices, min_weight, 0); // O(n^3)
 
     // If no better solution have been found, return the original clique and put the tested vertex in tested_verticies
     if (improvement <= min_weight)
     {
-        tested_vertices->insert(min_weight_vertex);
+        tested_vertices->insert(*min_weight_vertex);
         return init_clique;
     }
 
@@ -285,7 +243,7 @@ Clique findNeighbor(Graph g, Clique init_clique, std::unordered_set<VertexPtr> *
 Clique localSearchMEWC(const Graph &g)
 {
     Clique max_clique = findInitialSolution(g);    // The initial solution that may be improved ( O(n^3) )
-    std::unordered_set<VertexPtr> tested_vertices; // The vertices that have been tested
+    std::unordered_set<VertexId> tested_vertices;  // The vertices that have been tested
 
     // As long as the break conditions have not been reached
     while (1) // n² times
@@ -305,8 +263,263 @@ Clique localSearchMEWC(const Graph &g)
         }
         else
             // If a better solution have been found, we must try again every vertices that have already been removed
-            tested_vertices = std::unordered_set<VertexPtr>();
+            tested_vertices = std::unordered_set<VertexId>();
     }
 
     return max_clique;
+}
+
+/**
+ * @brief Improve the given clique of a subgraph of a frozen graph to find a
+ * maximal clique.
+ *
+ * This is the same function as above, working on the indices of a FrozenGraph.
+ * The vertices excluded from the view are treated as banned vertices.
+ *
+ * @param view The subgraph view to find the maximal clique in
+ * @param clique The indices of the clique that may be improved
+ * @param banned_vertices The vertices that cannot be in the max clique
+ * @param min_weight The minimum weight improvement that needs to be done
+ * @param actual_weight_improvement The actual improvement in weight that has been made since this function was first called
+ * @return The weight improvement if the clique has been improved, 0 otherwise
+ */
+unsigned int improveClique(
+    const SubgraphView &view,
+    std::vector<unsigned int> &clique,
+    std::vector<bool> banned_vertices,
+    unsigned int min_weight = 0,
+    unsigned int actual_weight_improvement = 0)
+{
+    if (clique.empty())
+        return 0;
+
+    const FrozenGraph &g = view.graph();
+
+    // Copy the initial clique
+    std::vector<unsigned int> clique2 = clique;
+
+    unsigned int v = clique.front(); // a random vertex in the clique
+
+    // Try to find a vertex which is not in the clique but
+    // which has all the vertices of the clique as neighbours
+    for (unsigned int vertex = 0; vertex < g.size(); vertex++) // O(n^2)
+    {
+        // If the vertex is out of the view, in the clique or banned, continue
+        if (!view.hasVertex(vertex) || banned_vertices[vertex] || std::find(clique.begin(), clique.end(), vertex) != clique.end())
+            continue;
+
+        // If we have no edge between the vertex and the random vertex of the
+        // clique, we can ban it
+        if (!g.hasEdge(v, vertex))
+        {
+            banned_vertices[vertex] = true;
+            continue;
+        }
+
+        // See if the vertex is adjacent to all vertices of the clique and
+        // calculate the weight improvement when adding it to the clique
+        bool valid = true;
+        unsigned int weight_improvement = 0;
+        for (auto clique_vertex : clique) // O(n)
+        {
+            unsigned int weight = g.weight(clique_vertex, vertex);
+            if (weight == 0 && !g.hasEdge(clique_vertex, vertex))
+            {
+                valid = false;
+                break;
+            }
+            weight_improvement += weight;
+        }
+        if (!valid)
+            continue;
+
+        clique2.push_back(vertex);
+
+        // See if we can improve more the clique
+        unsigned int total_weight_improvement = weight_improvement + improveClique(
+                                                                         view,
+                                                                         clique2,
+                                                                         banned_vertices,
+                                                                         min_weight,
+                                                                         actual_weight_improvement + weight_improvement); // Called maximum n times
+
+        // If we are not better than the old solution, return 0
+        if (total_weight_improvement + actual_weight_improvement <= min_weight)
+            return 0;
+
+        // The clique has been improved, so we replace the original one by the improved one
+        clique = clique2;
+        return total_weight_improvement;
+    }
+
+    // If we didn't improve the clique, stop recursivity
+    return 0;
+}
+
+/**
+ * @brief Find a first solution to start with in a subgraph of a frozen graph.
+ *
+ * The degrees are the degrees in the view.
+ *
+ * @param view The subgraph view to find the maximal clique in
+ * @return The indices of the maximal clique found
+ */
+std::vector<unsigned int> findInitialSolution(const SubgraphView &view)
+{
+    if (view.size() < 2)
+        return {};
+
+    const FrozenGraph &g = view.graph();
+    std::vector<unsigned int> degrees(g.size(), 0);
+    std::vector<unsigned int> vertices = view.vertices();
+    for (auto v : vertices) // O(m)
+        degrees[v] = view.degree(v);
+
+    // Find the vertex of maximum degree in the view
+    unsigned int max_vertex = vertices.front();
+    for (auto v : vertices) // O(n)
+        if (degrees[v] > degrees[max_vertex])
+            max_vertex = v;
+
+    // Without any edge, there is no clique to start with
+    if (degrees[max_vertex] == 0)
+        return {};
+
+    // Find its neighbour of maximum degree in the view
+    std::optional<unsigned int> max_vertex2;
+    for (auto v : g.neighbors(max_vertex)) // O(n)
+        if (view.hasVertex(v) && (!max_vertex2 || degrees[v] > degrees[max_vertex2.value()]))
+            max_vertex2 = v;
+
+    // Get a full clique based on these two vertices
+    std::vector<unsigned int> clique = {max_vertex, max_vertex2.value()};
+    improveClique(view, clique, std::vector<bool>(g.size(), false), 0, 0); // O(n^3)
+
+    return clique;
+}
+
+/**
+ * @brief Try to find a better clique weight by removing a vertex in a subgraph
+ * of a frozen graph.
+ *
+ * @param view The subgraph view to find the maximal clique in
+ * @param init_clique The indices of the clique that may be improved
+ * @param weight The weight of the clique, updated if it is improved
+ * @param tested_vertices The vertices that will not be tested
+ * @return The max clique found by removing the vertex if it is better, the original one otherwise
+ */
+std::vector<unsigned int> findNeighbor(
+    const SubgraphView &view,
+    const std::vector<unsigned int> &init_clique,
+    long unsigned int &weight,
+    std::vector<bool> &tested_vertices)
+{
+    const FrozenGraph &g = view.graph();
+
+    // minimum weight added by a vertex in the clique
+    unsigned int min_weight = std::numeric_limits<unsigned int>::max();
+    std::optional<unsigned int> min_weight_vertex; // vertex that adds the minimum weight in the clique
+
+    // For all vertices in the clique
+    for (auto clique_vertex : init_clique) // O(n²)
+    {
+        // If the vertex has already been tested, do not try it another time
+        if (tested_vertices[clique_vertex])
+            continue;
+
+        // Get the weight between the vertex and all its neighbours in the clique
+        unsigned int weight = 0;
+        for (auto clique_vertex2 : init_clique)
+            weight += g.weight(clique_vertex, clique_vertex2);
+
+        // If the weight added by this vertex is less than the current minimum, modify it
+        if (weight < min_weight)
+        {
+            min_weight = weight;
+            min_weight_vertex = clique_vertex;
+        }
+    }
+
+    // If no improvements have been made, this means that all possibilities have been tested, so we return the original clique
+    if (!min_weight_vertex)
+        return init_clique;
+
+    // Create a new clique which is a copy of the original with the tested vertex removed
+    std::vector<unsigned int> new_clique;
+    for (auto clique_vertex : init_clique) // O(n)
+        if (clique_vertex != min_weight_vertex.value())
+            new_clique.push_back(clique_vertex);
+
+    // Put the tested vertex as banned
+    std::vector<bool> banned_vertices(g.size(), false);
+    banned_vertices[min_weight_vertex.value()] = true;
+    unsigned int improvement = improveClique(view, new_clique, banned_vertices, min_weight, 0); // O(n^3)
+
+    // If no better solution have been found, return the original clique and put the tested vertex in tested_verticies
+    if (improvement <= min_weight)
+    {
+        tested_vertices[min_weight_vertex.value()] = true;
+        return init_clique;
+    }
+
+    // If a better solution have been found, return this solution along with
+    // its weight, without removed vertex but with the added ones
+    weight = weight - min_weight + improvement;
+    return new_clique;
+}
+
+/**
+ * @brief Finds the maximum weight clique in a subgraph of a frozen graph using
+ * a local search algorithm.
+ *
+ * @param view The subgraph view to find the maximal clique in
+ * @return The maximum weight clique found by local search
+ */
+Clique localSearchMEWC(const SubgraphView &view)
+{
+    const FrozenGraph &g = view.graph();
+
+    std::vector<unsigned int> max_clique = findInitialSolution(view); // O(n^3)
+    long unsigned int weight = g.weight(max_clique);                   // The weight of the clique, kept up to date by findNeighbor
+    std::vector<bool> tested_vertices(g.size(), false);                // The vertices that have been tested
+    long unsigned int tested_vertices_count = 0;                       // The number of tested vertices
+
+    // As long as the break conditions have not been reached
+    while (1) // n² times
+    {
+        long unsigned int c_weight = weight; // The weight of the clique before modifying it
+
+        // Try improving the clique weight by removing a vertex
+        max_clique = findNeighbor(view, max_clique, weight, tested_vertices); // O(n^3)
+
+        // If the weight of the clique is still the same, that means that it has not been improved
+        if (weight == c_weight)
+        {
+            // If the number of tested vertices is still the same, that means that we do not have any other vertex to try
+            long unsigned int count = std::count(tested_vertices.begin(), tested_vertices.end(), true);
+            if (count == tested_vertices_count)
+                break;
+            tested_vertices_count = count;
+        }
+        else
+        {
+            // If a better solution have been found, we must try again every vertices that have already been removed
+            tested_vertices.assign(g.size(), false);
+            tested_vertices_count = 0;
+        }
+    }
+
+    return g.clique(max_clique);
+}
+
+/**
+ * @brief Finds the maximum weight clique in a frozen graph using a local search
+ * algorithm.
+ *
+ * @param g The frozen graph to find the maximal clique in
+ * @return The maximum weight clique found by local search
+ */
+Clique localSearchMEWC(const FrozenGraph &g)
+{
+    return localSearchMEWC(SubgraphView(g));
 }
\ No newline at end of file
@@ -18,18 +18,56 @@
  *
  * @param graph The graph to run the algorithm on
  * @param algorithm The algorithm to run
- * @param argv The command line arguments
+ * @param options The options of the algorithm
  * @return Clique The clique found by the algorithm
  * @throws std::invalid_argument If the algorithm is invalid
  */
-Clique runMEWC(const Graph &graph, const Algorithm &algorithm)
+Clique runMEWC(const Graph &graph, const Algorithm &algorithm, const MEWCOptions &options)
 {
     switch (algorithm)
     {
     case Algorithm::Exact:
-        return exactMEWC(graph);
+        return exactMEWC(graph, options);
+    case Algorithm::ExactBnB:
+        return exactBnBMEWC(graph, options);
     case Algorithm::Constructive:
-        return constructiveMEWC(graph);
+        return constructiveMEWC(graph, options);
+    case Algorithm::ConstructiveMultistart:
+        return constructiveMultistartMEWC(graph, options);
+    case Algorithm::ConstructiveGain:
+        return constructiveGainMEWC(graph);
+    case Algorithm::LocalSearch:
+        return localSearchMEWC(graph);
+    case Algorithm::Grasp:
+        return graspMEWC(graph);
+    default:
+        throw std::invalid_argument("Invalid algorithm");
+    }
+}
+
+/**
+ * @brief Run the algorithm on a frozen graph
+ *
+ * @param graph The frozen graph to run the algorithm on
+ * @param algorithm The algorithm to run
+ * @param options The options of the algorithm
+ * @return Clique The clique found by the algorithm
+ * @throws std::invalid_argument If the algorithm is invalid
+ */
+Clique runMEWC(const FrozenGraph &graph, const Algorithm &algorithm, const MEWCOptions &options)
+{
+    switch (algorithm)
+    {
+    case Algorithm::Exact:
+        return exactMEWC(graph, options);
+    case Algorithm::ExactBnB:
+        return exactBnBMEWC(graph, options);
+    case Algorithm::Constructive:
+        return constructiveMEWC(graph, options);
+    case Algorithm::ConstructiveMultistart:
+        return constructiveMultistartMEWC(graph, options);
+    case Algorithm::ConstructiveGain:
+        return constructiveGainMEWC(graph);
     case Algorithm::LocalSearch:
         return localSearchMEWC(graph);
     case Algorithm::Grasp:
@@ -53,8 +91,14 @@ Algorithm getAlgorithm(const std::string &algorithm)
 {
     if (algorithm == "exact")
         return Algorithm::Exact;
+    else if (algorithm == "exact-bnb")
+        return Algorithm::ExactBnB;
     else if (algorithm == "constructive")
         return Algorithm::Constructive;
+    else if (algorithm == "constructive-multistart")
+        return Algorithm::ConstructiveMultistart;
+    else if (algorithm == "constructive-gain")
+        return Algorithm::ConstructiveGain;
     else if (algorithm == "local-search")
         return Algorithm::LocalSearch;
     else if (algorithm == "grasp")
@@ -78,8 +122,14 @@ std::string getAlgorithmName(const Algorithm &algorithm)
     {
     case Algorithm::Exact:
         return "exact";
+    case Algorithm::ExactBnB:
+        return "exact-bnb";
     case Algorithm::Constructive:
         return "constructive";
+    case Algorithm::ConstructiveMultistart:
+        return "constructive-multistart";
+    case Algorithm::ConstructiveGain:
+        return "constructive-gain";
     case Algorithm::LocalSearch:
         return "local-search";
     case Algorithm::Grasp:
@@ -87,4 +137,86 @@ std::string getAlgorithmName(const Algorithm &algorithm)
     default:
         return "invalid";
     }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Get the pivot rule from a string
+ *
+ * @param pivot The string to convert
+ * @return Pivot The pivot rule corresponding to the string
+ * @throws std::invalid_argument If the string is invalid
+ */
+Pivot getPivot(const std::string &pivot)
+{
+    if (pivot == "first")
+        return Pivot::First;
+    else if (pivot == "tomita")
+        return Pivot::Tomita;
+    else
+        throw std::invalid_argument("Invalid pivot");
+}
+
+/**
+ * @brief Get the engine of the exact algorithm from a string
+ *
+ * @param engine The string to convert
+ * @return Engine The engine corresponding to the string
+ * @throws std::invalid_argument If the string is invalid
+ */
+Engine getEngine(const std::string &engine)
+{
+    if (engine == "sparse")
+        return Engine::Sparse;
+    else if (engine == "bit-parallel")
+        return Engine::BitParallel;
+    else
+        throw std::invalid_argument("Invalid engine");
+}
+
+/**
+ * @brief Get the scoring policy of the constructive algorithm from a string
+ *
+ * @param score The string to convert
+ * @return Score The scoring policy corresponding to the string
+ * @throws std::invalid_argument If the string is invalid
+ */
+Score getScore(const std::string &score)
+{
+    if (score == "degree")
+        return Score::Degree;
+    else if (score == "weighted-degree")
+        return Score::WeightedDegree;
+    else if (score == "gain")
+        return Score::Gain;
+    else if (score == "gain-degree")
+        return Score::GainDegree;
+    else if (score == "degree-weight")
+        return Score::DegreeWeight;
+    else
+        throw std::invalid_argument("Invalid score");
+}
+
+/**
+ * @brief Get the name of the scoring policy of the constructive algorithm
+ *
+ * @param score The scoring policy to get the name of
+ * @return std::string The name of the scoring policy
+ */
+std::string getScoreName(const Score &score)
+{
+    switch (score)
+    {
+    case Score::Degree:
+        return "degree";
+    case Score::WeightedDegree:
+        return "weighted-degree";
+    case Score::Gain:
+        return "gain";
+    case Score::GainDegree:
+        return "gain-degree";
+    case Score::DegreeWeight:
+        return "degree-weight";
+    default:
+        return "invalid";
+    }
+}
@@ -6,29 +6,116 @@
  * @date 2022-12-27
  */
 
+#include <functional>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include "../model/clique.hpp"
+#include "../model/frozen_graph.hpp"
 #include "../model/graph.hpp"
+#include "../model/subgraph_view.hpp"
 
 #ifndef MEWC_HPP
 #define MEWC_HPP
 
+class SearchMonitor;
+
 enum Algorithm
 {
     Exact,
+    ExactBnB,
     Constructive,
+    ConstructiveMultistart,
+    ConstructiveGain,
     LocalSearch,
     Grasp
 };
 
-Clique exactMEWC(const Graph &g);
-Clique constructiveMEWC(const Graph &g);
+// Pivot rule of the Bron-Kerbosch algorithm
+enum Pivot
+{
+    First, // first vertex of P
+    Tomita // vertex of P U X with the most neighbors in P
+};
+
+// Engine of the Bron-Kerbosch algorithm on frozen graphs
+enum Engine
+{
+    Sparse,     // sorted vectors of indices
+    BitParallel // bitsets with per-depth buffers, on graphs whose bit matrix fits
+};
+
+// Scoring policy of the constructive algorithm (see greedy_kernel.hpp)
+enum Score
+{
+    Degree,         // highest degree
+    WeightedDegree, // highest sum of edge weights
+    Gain,           // highest sum of edge weights to the clique, then sum of edge weights
+    GainDegree,     // highest sum of edge weights to the clique, then degree
+    DegreeWeight    // highest degree, then sum of edge weights
+};
+
+/**
+ * @brief The options of the algorithms
+ *
+ * Each algorithm only reads the options that concern it.
+ */
+struct MEWCOptions
+{
+    Pivot pivot = Pivot::Tomita;         // exact
+    Engine engine = Engine::BitParallel; // exact
+    unsigned int threads = 1;            // exact, exact-bnb, constructive-multistart
+    unsigned int starts = 0;             // constructive-multistart: seed vertices, 0 for all of them
+    Score score = Score::Degree;         // constructive
+    std::optional<Algorithm> warmStart;  // exact-bnb: constructive or local-search
+    double timeLimit = 0;                // exact, exact-bnb: in seconds, 0 for no limit
+    bool progress = false;               // exact, exact-bnb: print progress lines
+    std::string checkpoint;              // exact: file to save the search to, if any
+    double checkpointInterval = 60;      // exact: time between two checkpoints, in seconds
+    std::string resume;                  // exact: checkpoint to resume the search from, if any
+    SearchMonitor *monitor = nullptr;    // exact, exact-bnb: monitor shared with other searches, which reports instead of them
+};
+
+// Function called on each clique found by an enumeration, with its vertices
+// (indices of a FrozenGraph) and its weight
+typedef std::function<void(const std::vector<unsigned int> &, long unsigned int)> CliqueVisitor;
+
+Clique exactMEWC(const Graph &g, const MEWCOptions &options = MEWCOptions());
+Clique exactBnBMEWC(const Graph &g, const MEWCOptions &options = MEWCOptions());
+Clique constructiveMEWC(const Graph &g, const MEWCOptions &options = MEWCOptions());
+Clique constructiveMultistartMEWC(const Graph &g, const MEWCOptions &options = MEWCOptions());
+Clique constructiveGainMEWC(const Graph &g);
 Clique localSearchMEWC(const Graph &g);
 Clique graspMEWC(const Graph &g);
-Clique runMEWC(const Graph &graph, const Algorithm &algorithm);
+Clique runMEWC(const Graph &graph, const Algorithm &algorithm, const MEWCOptions &options = MEWCOptions());
+
+Clique exactMEWC(const FrozenGraph &g, const MEWCOptions &options = MEWCOptions());
+Clique exactBnBMEWC(const FrozenGraph &g, const MEWCOptions &options = MEWCOptions());
+std::vector<Clique> topKMEWC(const FrozenGraph &g, unsigned int k, const MEWCOptions &options = MEWCOptions());
+Clique constructiveMEWC(const FrozenGraph &g, const MEWCOptions &options = MEWCOptions());
+Clique constructiveMultistartMEWC(const FrozenGraph &g, const MEWCOptions &options = MEWCOptions());
+Clique constructiveGainMEWC(const FrozenGraph &g);
+Clique localSearchMEWC(const FrozenGraph &g);
+Clique graspMEWC(const FrozenGraph &g);
+Clique runMEWC(const FrozenGraph &graph, const Algorithm &algorithm, const MEWCOptions &options = MEWCOptions());
+Clique componentsMEWC(const FrozenGraph &graph, const Algorithm &algorithm, const MEWCOptions &options = MEWCOptions());
+
+Clique exactMEWC(const SubgraphView &g, const MEWCOptions &options = MEWCOptions());
+Clique exactBnBMEWC(const SubgraphView &g, const MEWCOptions &options = MEWCOptions());
+std::vector<Clique> topKMEWC(const SubgraphView &g, unsigned int k, const MEWCOptions &options = MEWCOptions());
+void enumerateMaximalCliques(const SubgraphView &g, const CliqueVisitor &visitor, const MEWCOptions &options = MEWCOptions());
+Clique constructiveMEWC(const SubgraphView &g, const MEWCOptions &options = MEWCOptions());
+Clique constructiveMultistartMEWC(const SubgraphView &g, const MEWCOptions &options = MEWCOptions());
+Clique constructiveGainMEWC(const SubgraphView &g);
+Clique localSearchMEWC(const SubgraphView &g);
+Clique graspMEWC(const SubgraphView &g);
 
 Algorithm getAlgorithm(const std::string &algorithm);
 std::string getAlgorithmName(const Algorithm &algorithm);
+Pivot getPivot(const std::string &pivot);
+Engine getEngine(const std::string &engine);
+Score getScore(const std::string &score);
+std::string getScoreName(const Score &score);
 
 #endif // MEWC_HPP
\ No newline at end of file
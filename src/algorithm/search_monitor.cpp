@@ -0,0 +1,152 @@
+/**
+ * @file search_monitor.cpp
+ * @brief Implementation of the SearchMonitor class
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <algorithm>
+#include <iostream>
+
+#include "search_monitor.hpp"
+
+/**
+ * @brief Construct a new SearchMonitor:: SearchMonitor object
+ *
+ * The clock starts when the monitor is created.
+ *
+ * @param name The name of the search, printed on the progress lines
+ * @param time_limit The time after which the search must stop, in seconds, or
+ * 0 for no limit
+ * @param progress Whether to print progress lines
+ * @param checkpoint_interval The time between two checkpoints, in seconds, or
+ * 0 for no checkpoint
+ */
+SearchMonitor::SearchMonitor(const std::string &name, double time_limit, bool progress, double checkpoint_interval)
+    : _name(name),
+      _timeLimit(time_limit),
+      _progress(progress),
+      _checkpointInterval(checkpoint_interval),
+      _shared(false),
+      _start(std::chrono::steady_clock::now()),
+      _nodes(0),
+      _incumbent(-1),
+      _bound(-1),
+      _stopped(false),
+      _checkpointDue(false),
+      _lastProgress(0),
+      _lastCheckpoint(0)
+{
+}
+
+/**
+ * @brief Destroy the SearchMonitor:: SearchMonitor object
+ */
+SearchMonitor::~SearchMonitor()
+{
+}
+
+/* SET METHODS */
+
+/**
+ * @brief Record the weight of a clique found by the search
+ *
+ * @param weight The weight of the clique
+ */
+void SearchMonitor::improveIncumbent(long unsigned int weight)
+{
+    long int incumbent = _incumbent.load(std::memory_order_relaxed);
+    while (static_cast<long int>(weight) > incumbent &&
+           !_incumbent.compare_exchange_weak(incumbent, weight, std::memory_order_relaxed))
+        ;
+}
+
+/**
+ * @brief Record that the search saved a checkpoint, the next one being due
+ * after the checkpoint interval
+ */
+void SearchMonitor::checkpointSaved()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _lastCheckpoint = elapsed();
+    _checkpointDue.store(false);
+}
+
+/* GET METHODS */
+
+/**
+ * @brief Get the time elapsed since the start of the search
+ *
+ * @return double The elapsed time, in seconds
+ */
+double SearchMonitor::elapsed() const
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - _start).count();
+}
+
+/* PRINT METHODS */
+
+/**
+ * @brief Print how the search ended on the standard error
+ *
+ * The search is proven optimal if it was not stopped by the time limit.
+ */
+void SearchMonitor::report() const
+{
+    if (!_progress && _timeLimit <= 0)
+        return;
+
+    printProgress();
+    if (stopped())
+        std::cerr << _name << ": time limit reached, the clique found is not proven optimal" << std::endl;
+    else
+        std::cerr << _name << ": search complete, the clique found is optimal" << std::endl;
+}
+
+/**
+ * @brief Check the clock, stop the search when the time limit is reached and
+ * print a progress line or ask for a checkpoint when it is due
+ */
+void SearchMonitor::check()
+{
+    // Another worker is already checking
+    std::unique_lock<std::mutex> lock(_mutex, std::try_to_lock);
+    if (!lock.owns_lock())
+        return;
+
+    double time = elapsed();
+    if (_timeLimit > 0 && time >= _timeLimit)
+        _stopped.store(true);
+    if (_checkpointInterval > 0 && time - _lastCheckpoint >= _checkpointInterval)
+        _checkpointDue.store(true);
+    if (_progress && time - _lastProgress >= PROGRESS_INTERVAL)
+    {
+        _lastProgress = time;
+        printProgress();
+    }
+}
+
+/**
+ * @brief Print a progress line on the standard error
+ *
+ * The line holds the elapsed time, the number of nodes explored, the weight of
+ * the heaviest clique found so far and the upper bound, if known.
+ */
+void SearchMonitor::printProgress() const
+{
+    long int incumbent = _incumbent.load();
+    long int bound = _bound.load();
+
+    std::cerr << _name << ": " << elapsed() << " s, " << nodes() << " nodes, incumbent ";
+    if (incumbent < 0)
+        std::cerr << "-";
+    else
+        std::cerr << incumbent;
+    std::cerr << ", bound ";
+    if (bound < 0)
+        std::cerr << "-";
+    else
+        std::cerr << std::max(bound, incumbent);
+    std::cerr << std::endl;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file search_monitor.hpp
+ * @brief Declaration of the SearchMonitor class
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+
+#ifndef SEARCH_MONITOR_HPP
+#define SEARCH_MONITOR_HPP
+
+// Number of nodes between two checks of the clock
+#define CLOCK_CHECK_NODES 1024
+
+// Time between two progress lines, in seconds
+#define PROGRESS_INTERVAL 1.0
+
+/**
+ * @brief The SearchMonitor class
+ *
+ * This class follows an exact search: it counts the nodes explored, keeps the
+ * weight of the heaviest clique found so far (the incumbent) and an upper
+ * bound of the weight of the maximum clique, and stops the search when the
+ * time limit is reached. It can be shared by the workers of a parallel search.
+ *
+ * It also tells a search when a checkpoint is due: the search then pauses,
+ * saves its state and calls checkpointSaved() before going on.
+ *
+ * A monitor may be shared by the searches of several subproblems (the
+ * connected components of a graph, for instance), so that they stop together
+ * at the time limit. The bound of a subproblem doesn't hold for the others, so
+ * setBound() is ignored while the monitor is shared.
+ *
+ * The searches call visit() on each node and backtrack as soon as it returns
+ * false. The clock is only read every CLOCK_CHECK_NODES nodes, and when
+ * progress is enabled a line is printed on the standard error every
+ * PROGRESS_INTERVAL seconds.
+ */
+class SearchMonitor
+{
+public:
+    SearchMonitor(const std::string &name, double time_limit = 0, bool progress = false, double checkpoint_interval = 0);
+    ~SearchMonitor();
+
+    // Set methods
+    void improveIncumbent(long unsigned int weight);
+    inline void setBound(long unsigned int bound)
+    {
+        if (!_shared)
+            _bound.store(bound, std::memory_order_relaxed);
+    }
+    inline void setShared(bool shared) { _shared = shared; }
+    inline void addNodes(long unsigned int nodes) { _nodes.fetch_add(nodes); }
+    void checkpointSaved();
+
+    /**
+     * @brief Count a node of the search
+     *
+     * @return true If the search can go on, false if it must stop
+     */
+    inline bool visit()
+    {
+        if (_nodes.fetch_add(1, std::memory_order_relaxed) % CLOCK_CHECK_NODES == CLOCK_CHECK_NODES - 1)
+            check();
+        return !_stopped.load(std::memory_order_relaxed);
+    }
+
+    // Get methods
+    inline long unsigned int nodes() const { return _nodes.load(); }
+    double elapsed() const;
+
+    // Boolean methods
+    inline bool stopped() const { return _stopped.load(std::memory_order_relaxed); }
+    inline bool checkpointDue() const { return _checkpointDue.load(std::memory_order_relaxed); }
+
+    // Check the clock now instead of waiting for the next visit() to do it
+    void check();
+
+    // Print methods
+    void report() const;
+
+private:
+    void printProgress() const;
+
+    std::string _name;
+    double _timeLimit; // seconds, 0 for no limit
+    bool _progress;
+    double _checkpointInterval; // seconds, 0 for no checkpoint
+    bool _shared;               // whether several subproblems are searched
+    std::chrono::steady_clock::time_point _start;
+
+    std::atomic<long unsigned int> _nodes;
+    std::atomic<long int> _incumbent; // -1 as long as no clique has been found
+    std::atomic<long int> _bound;     // -1 as long as no bound is known
+    std::atomic<bool> _stopped;
+    std::atomic<bool> _checkpointDue;
+
+    std::mutex _mutex;      // held while checking the clock and printing
+    double _lastProgress;   // elapsed time of the last progress line
+    double _lastCheckpoint; // elapsed time of the last checkpoint
+};
+
+#endif // SEARCH_MONITOR_HPP
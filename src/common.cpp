@@ -6,6 +6,9 @@
  * @date 2022-12-26
  */
 
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
@@ -121,13 +124,9 @@ Graph read_file(std::string path)
 
     Graph graph = Graph();
 
-    // Create a vector of vertices of size num_vertices and initialize them
-    std::vector<VertexPtr> vertices(num_vertices);
+    // Add the vertices, whose ids go from 1 to num_vertices
     for (unsigned int i = 0; i < num_vertices; i++)
-    {
-        vertices[i] = std::make_shared<Vertex>(i + 1);
-        graph.addVertex(vertices[i]);
-    }
+        graph.addVertex(i + 1);
 
     // Read the rest of the file
     while (std::getline(input_file, line))
@@ -165,13 +164,8 @@ Graph read_file(std::string path)
             exit(1);
         }
 
-        // Get the source and destination vertices
-        VertexPtr source_vertex = vertices[source - 1];
-        VertexPtr destination_vertex = vertices[destination - 1];
-
-        // Create the edge
-        EdgePtr edge = std::make_shared<Edge>(source_vertex, destination_vertex, weight);
-        graph.addEdge(edge);
+        // Create the edge between the source and destination vertices
+        graph.addEdge(source, destination, weight);
     }
 
     // Close the input file
@@ -225,4 +219,44 @@ std::optional<long unsigned int> find_option(std::vector<std::string> args, std:
         if (it->substr(0, option.size()) == option)
             return it - args.begin();
     return {};
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Parse the value of a count option
+ *
+ * This method parses a non-negative integer, such as a number of threads. A
+ * negative number or any other character makes the value invalid.
+ *
+ * @param value The value of the option
+ * @return std::optional<long unsigned int> The count or an empty optional if
+ * the value is invalid
+ */
+std::optional<long unsigned int> parse_count(const std::string &value)
+{
+    if (value.empty() || value.size() > 18 || value.find_first_not_of("0123456789") != std::string::npos)
+        return {};
+    return std::stoul(value);
+}
+
+/**
+ * @brief Parse the value of a duration option
+ *
+ * This method parses a positive number of seconds, such as a time limit, with
+ * an optional decimal part. A negative or null duration or any other character
+ * makes the value invalid.
+ *
+ * @param value The value of the option
+ * @return std::optional<double> The duration in seconds or an empty optional if
+ * the value is invalid
+ */
+std::optional<double> parse_seconds(const std::string &value)
+{
+    if (value.find_first_of("0123456789") == std::string::npos ||
+        value.find_first_not_of("0123456789.") != std::string::npos ||
+        std::count(value.begin(), value.end(), '.') > 1)
+        return {};
+    double seconds = std::strtod(value.c_str(), nullptr);
+    if (!std::isfinite(seconds) || seconds <= 0)
+        return {};
+    return seconds;
+}
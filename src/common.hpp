@@ -18,10 +18,15 @@
 // Macro to suppress unused variable warnings
 #define UNUSED(x) (void)(x)
 
+// Highest number of threads accepted on the command line
+#define MAX_THREADS 1024
+
 void check_file(std::string path);
 void check_directory(std::string path);
 Graph read_file(std::string path);
 std::vector<std::string> split(const std::string &s, char delim);
 std::optional<long unsigned int> find_option(std::vector<std::string> args, std::string option);
+std::optional<long unsigned int> parse_count(const std::string &value);
+std::optional<double> parse_seconds(const std::string &value);
 
 #endif // COMMON_HPP
\ No newline at end of file
@@ -11,7 +11,10 @@
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <limits>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "common.hpp"
@@ -64,6 +67,172 @@ int main(int argc, char **argv)
         args.erase(args.begin() + i.value());
     }
 
+    // Find and pop the options of the algorithm
+    MEWCOptions options;
+    if (auto i = find_option(args, "--pivot="))
+    {
+        try
+        {
+            options.pivot = getPivot(args.at(i.value()).substr(8));
+        }
+        catch (const std::invalid_argument &e)
+        {
+            print_usage(argv);
+            exit(1);
+        }
+        args.erase(args.begin() + i.value());
+    }
+    if (auto i = find_option(args, "--engine="))
+    {
+        try
+        {
+            options.engine = getEngine(args.at(i.value()).substr(9));
+        }
+        catch (const std::invalid_argument &e)
+        {
+            print_usage(argv);
+            exit(1);
+        }
+        args.erase(args.begin() + i.value());
+    }
+
+    if (auto i = find_option(args, "--threads="))
+    {
+        auto threads = parse_count(args.at(i.value()).substr(10));
+        if (!threads.has_value())
+        {
+            print_usage(argv);
+            exit(1);
+        }
+        options.threads = std::min<long unsigned int>(threads.value(), MAX_THREADS);
+        if (options.threads == 0)
+            options.threads = std::max(1u, std::thread::hardware_concurrency());
+        args.erase(args.begin() + i.value());
+    }
+
+    if (auto i = find_option(args, "--score="))
+    {
+        try
+        {
+            options.score = getScore(args.at(i.value()).substr(8));
+        }
+        catch (const std::invalid_argument &e)
+        {
+            print_usage(argv);
+            exit(1);
+        }
+        args.erase(args.begin() + i.value());
+    }
+
+    if (auto i = find_option(args, "--starts="))
+    {
+        auto starts = parse_count(args.at(i.value()).substr(9));
+        if (!starts.has_value())
+        {
+            print_usage(argv);
+            exit(1);
+        }
+        options.starts = std::min<long unsigned int>(starts.value(), std::numeric_limits<unsigned int>::max());
+        args.erase(args.begin() + i.value());
+    }
+
+    if (auto i = find_option(args, "--warm-start="))
+    {
+        try
+        {
+            options.warmStart = getAlgorithm(args.at(i.value()).substr(13));
+        }
+        catch (const std::invalid_argument &e)
+        {
+            print_usage(argv);
+            exit(1);
+        }
+        if (options.warmStart != Algorithm::Constructive && options.warmStart != Algorithm::LocalSearch)
+        {
+            print_usage(argv);
+            exit(1);
+        }
+        args.erase(args.begin() + i.value());
+    }
+
+    if (auto i = find_option(args, "--time-limit="))
+    {
+        auto time_limit = parse_seconds(args.at(i.value()).substr(13));
+        if (!time_limit.has_value())
+        {
+            print_usage(argv);
+            exit(1);
+        }
+        options.timeLimit = time_limit.value();
+        options.progress = true;
+        args.erase(args.begin() + i.value());
+    }
+    if (auto i = find_option(args, "--progress"))
+    {
+        options.progress = true;
+        args.erase(args.begin() + i.value());
+    }
+
+    if (auto i = find_option(args, "--checkpoint-interval="))
+    {
+        auto interval = parse_seconds(args.at(i.value()).substr(22));
+        if (!interval.has_value())
+        {
+            print_usage(argv);
+            exit(1);
+        }
+        options.checkpointInterval = interval.value();
+        args.erase(args.begin() + i.value());
+    }
+    if (auto i = find_option(args, "--checkpoint="))
+    {
+        options.checkpoint = args.at(i.value()).substr(13);
+        args.erase(args.begin() + i.value());
+    }
+    if (auto i = find_option(args, "--resume="))
+    {
+        options.resume = args.at(i.value()).substr(9);
+        args.erase(args.begin() + i.value());
+    }
+
+    // Find and pop the kernelize argument
+    bool kernelize = false;
+    if (auto i = find_option(args, "--kernelize"))
+    {
+        kernelize = true;
+        args.erase(args.begin() + i.value());
+    }
+
+    // Find and pop the components argument
+    bool components = false;
+    if (auto i = find_option(args, "--components"))
+    {
+        components = true;
+        args.erase(args.begin() + i.value());
+    }
+
+    // Find and pop the enumerate argument
+    std::string enumerate_path;
+    if (auto i = find_option(args, "--enumerate="))
+    {
+        enumerate_path = args.at(i.value()).substr(12);
+        args.erase(args.begin() + i.value());
+    }
+
+    // Find and pop the top-k argument
+    unsigned int top_k = 0;
+    if (auto i = find_option(args, "--top-k="))
+    {
+        auto k = parse_count(args.at(i.value()).substr(8));
+        if (!k.has_value() || k.value() == 0 || k.value() > std::numeric_limits<unsigned int>::max())
+        {
+            print_usage(argv);
+            exit(1);
+        }
+        top_k = k.value();
+        args.erase(args.begin() + i.value());
+    }
+
     // Find and pop the output-dir argument
     std::string output_dir = "//unset";
     if (auto i = find_option(args, "--output-dir="))
@@ -101,21 +270,115 @@ int main(int argc, char **argv)
     // Check if the output directory is valid
     check_directory(output_dir);
 
+    // The score is part of the name when it isn't the default one, so that the
+    // results of the scoring policies don't overwrite each other
+    std::string output_name = top_k > 0 ? "top-k" : getAlgorithmName(algorithm);
+    if (top_k == 0 && algorithm == Algorithm::Constructive && options.score != Score::Degree)
+        output_name += "-" + getScoreName(options.score);
     std::string output_file =
-        input_file.substr(0, input_file.find_last_of(".")) +
-        "_" + getAlgorithmName(algorithm) + ".out";
+        input_file.substr(0, input_file.find_last_of(".")) + "_" + output_name + ".out";
     // replace all '-' with '_' in the output file name
     std::replace(output_file.begin(), output_file.end(), '-', '_');
 
     // Read the input file
     Graph graph = read_file(input_path);
+
+    // Shrink the graph to the vertices and edges that can be in a clique at
+    // least as heavy as the one found by the constructive heuristic, which is
+    // kept in case the algorithm finds a lighter one on the smaller graph (the
+    // lighter cliques are needed by the enumeration and the top-k query)
+    Clique lower_bound;
+    if (kernelize && enumerate_path.empty() && top_k == 0)
+    {
+        lower_bound = constructiveMEWC(graph);
+        KernelReport report = graph.kernelize(lower_bound.weight(graph));
+        std::cerr << "Kernelization: removed " << report.vertices << " vertices and "
+                  << report.edges << " edges in " << report.rounds << " rounds (lower bound "
+                  << lower_bound.weight(graph) << ", " << graph.size() << " vertices left)" << std::endl;
+    }
+
+    // Take a snapshot of the graph for the algorithms
+    FrozenGraph frozen(graph);
     Clique clique;
 
+    // Stream all the maximal cliques to a file instead of running an algorithm
+    if (!enumerate_path.empty())
+    {
+        std::ofstream enumerate_output(enumerate_path, std::ios::out);
+        if (!enumerate_output.is_open())
+        {
+            std::cout << "Error: Could not open enumerate file" << std::endl;
+            exit(1);
+        }
+
+        // Write one line per maximal clique: its weight and the ids of its
+        // vertices in increasing order (the indices are in the order of the ids)
+        std::vector<unsigned int> sorted;
+        auto writeClique = [&](const std::vector<unsigned int> &vertices, long unsigned int weight)
+        {
+            sorted.assign(vertices.begin(), vertices.end());
+            std::sort(sorted.begin(), sorted.end());
+            enumerate_output << weight;
+            for (auto v : sorted)
+                enumerate_output << " " << frozen.id(v);
+            enumerate_output << "\n";
+        };
+
+        auto start = std::chrono::high_resolution_clock::now();
+        enumerateMaximalCliques(SubgraphView(frozen), writeClique, options);
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()
+                  << std::endl;
+
+        enumerate_output.close();
+        return 0;
+    }
+
+    // Write the k heaviest maximal cliques instead of the heaviest one, in the
+    // layout of the output file repeated for each clique
+    if (top_k > 0)
+    {
+        std::vector<Clique> cliques;
+        auto start = std::chrono::high_resolution_clock::now();
+        cliques = topKMEWC(frozen, top_k, options);
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()
+                  << std::endl;
+
+        std::ofstream output(output_dir + "/" + output_file, std::ios::out);
+        if (!output.is_open())
+        {
+            std::cout << "Error: Could not open output file" << std::endl;
+            exit(1);
+        }
+        for (auto &top : cliques)
+        {
+            output << top.size() << " "
+                   << top.weight(graph) << std::endl;
+            for (auto vertex : top.ids())
+                output << vertex << " ";
+            output << std::endl;
+        }
+        output.close();
+        return 0;
+    }
+
     // Run the algorithm
     for (int i = 0; i < runs; i++)
     {
         auto start = std::chrono::high_resolution_clock::now();
-        clique = runMEWC(graph, algorithm);
+        try
+        {
+            clique = components ? componentsMEWC(frozen, algorithm, options)
+                                : runMEWC(frozen, algorithm, options);
+        }
+        catch (const std::runtime_error &e)
+        {
+            std::cout << "Error: " << e.what() << std::endl;
+            exit(1);
+        }
+        if (clique.weight(graph) < lower_bound.weight(graph))
+            clique = lower_bound;
         auto end = std::chrono::high_resolution_clock::now();
         std::cout << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()
                   << std::endl;
@@ -132,19 +395,12 @@ int main(int argc, char **argv)
     }
 
     // Write the size of the clique and the weight of the clique
-    output << clique.vertices().size() << " "
+    output << clique.size() << " "
            << clique.weight(graph) << std::endl;
 
-    // Sort the vertices of the clique
-    std::vector<VertexPtr> vertices;
-    vertices.reserve(clique.vertices().size());
-    for (auto vertex : clique.vertices())
-        vertices.push_back(vertex);
-    std::sort(vertices.begin(), vertices.end());
-
-    // Write the vertices of the clique
-    for (auto vertex : vertices)
-        output << vertex->id() << " ";
+    // Write the vertices of the clique, which are kept sorted by their ids
+    for (auto vertex : clique.ids())
+        output << vertex << " ";
     output << std::endl;
 
     // Close the output file
@@ -167,6 +423,21 @@ void print_usage(char **argv)
     std::cout << "Usage: " << argv[0] << " <input-file> [options]" << std::endl;
     std::cout << "Options:" << std::endl;
     std::cout << "  --type=<type>        The algorithm type to use. Default: exact" << std::endl;
+    std::cout << "  --pivot=<pivot>      The pivot rule of the exact algorithm (first, tomita). Default: tomita" << std::endl;
+    std::cout << "  --engine=<engine>    The engine of the exact algorithm (sparse, bit-parallel). Default: bit-parallel" << std::endl;
+    std::cout << "  --score=<score>      The scoring policy of the constructive algorithm (degree, weighted-degree, gain, gain-degree, degree-weight). Default: degree" << std::endl;
+    std::cout << "  --threads=<n>        The number of threads of the exact and multistart algorithms, 0 for all the cores, at most 1024. Default: 1" << std::endl;
+    std::cout << "  --starts=<n>         The number of seed vertices of the multistart algorithm, 0 for all of them. Default: 0" << std::endl;
+    std::cout << "  --warm-start=<type>  Seed the exact-bnb algorithm with a heuristic clique (constructive, local-search)" << std::endl;
+    std::cout << "  --time-limit=<s>     Stop the exact algorithms after s > 0 seconds with the best clique found so far" << std::endl;
+    std::cout << "  --progress           Print the progress of the exact algorithms every second" << std::endl;
+    std::cout << "  --checkpoint=<file>  Save the state of the exact algorithm to a file periodically" << std::endl;
+    std::cout << "  --checkpoint-interval=<s> The time between two checkpoints, in seconds. Default: 60" << std::endl;
+    std::cout << "  --resume=<file>      Resume the exact algorithm from a checkpoint" << std::endl;
+    std::cout << "  --kernelize          Remove the vertices and edges that can't beat a constructive clique" << std::endl;
+    std::cout << "  --components         Run the algorithm on each connected component of the graph, one thread each but the heaviest" << std::endl;
+    std::cout << "  --enumerate=<file>   Write all the maximal cliques to a file instead of running the algorithm" << std::endl;
+    std::cout << "  --top-k=<k>          Write the k heaviest maximal cliques instead of the heaviest one" << std::endl;
     std::cout << "  --output-dir=<dir>   The directory to output the results to. Default: input directory" << std::endl;
     std::cout << "  --runs=<n>           The number of times to run the algorithm. Default: 1" << std::endl;
     std::cout << "  --help               Print this message" << std::endl;
@@ -0,0 +1,59 @@
+/**
+ * @file bit_adjacency.cpp
+ * @brief Implementation of the BitAdjacency class
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include "bit_adjacency.hpp"
+
+/**
+ * @brief Construct a new BitAdjacency:: BitAdjacency object
+ *
+ * The matrix is created without any edge.
+ *
+ * @param size The number of vertices
+ */
+BitAdjacency::BitAdjacency(unsigned int size)
+    : _size(size),
+      _words((size + WORD_BITS - 1) / WORD_BITS),
+      _matrix(static_cast<long unsigned int>(size) * _words, 0)
+{
+}
+
+/**
+ * @brief Destroy the BitAdjacency:: BitAdjacency object
+ */
+BitAdjacency::~BitAdjacency()
+{
+}
+
+/**
+ * @brief Check if a bit matrix is worth it for a graph
+ *
+ * The bit matrix takes n^2 / 8 bytes, which is only reasonable for dense
+ * graphs. It is considered worth it when it takes less memory than the
+ * neighbor and weight arrays of a FrozenGraph (16 bytes per edge).
+ *
+ * @param vertices The number of vertices of the graph
+ * @param edges The number of edges of the graph
+ * @return true If the bit matrix should be used, false otherwise
+ */
+bool BitAdjacency::fits(long unsigned int vertices, long unsigned int edges)
+{
+    return vertices * vertices / 8 <= 16 * edges;
+}
+
+/**
+ * @brief Get a bitset with all the vertices
+ *
+ * @return std::vector<uint64_t> The bitset
+ */
+std::vector<uint64_t> BitAdjacency::fullSet() const
+{
+    std::vector<uint64_t> set(_words, ~uint64_t(0));
+    if (_size % WORD_BITS)
+        set.back() = (uint64_t(1) << (_size % WORD_BITS)) - 1;
+    return set;
+}
@@ -0,0 +1,122 @@
+/**
+ * @file bit_adjacency.hpp
+ * @brief Declaration of the BitAdjacency class
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <cstdint>
+#include <vector>
+
+#ifndef BIT_ADJACENCY_HPP
+#define BIT_ADJACENCY_HPP
+
+// Number of bits in a word of a bitset
+#define WORD_BITS 64
+
+// Compile a function for AVX2 along with a portable version, the one matching
+// the CPU being chosen when the program is loaded. The bitset methods inlined
+// in such a function are then vectorized with AVX2 where available.
+#if defined(__GNUC__) && defined(__x86_64__) && !defined(__AVX2__)
+#define SIMD_CLONES __attribute__((target_clones("avx2", "default")))
+#else
+#define SIMD_CLONES
+#endif
+
+/**
+ * @brief The BitAdjacency class
+ *
+ * This class represents the adjacency matrix of a graph as a bit matrix, with
+ * one row of 64-bit words per vertex. Testing an edge is a single bit test and
+ * the intersection of a set of vertices with a neighborhood is a word-wise AND.
+ *
+ * The vertices are numbered from 0 to size() - 1 by the producer of the matrix
+ * (the ids for a Graph, the dense indices for a FrozenGraph). Sets of vertices
+ * are bitsets of words() words, which the static methods operate on.
+ */
+class BitAdjacency
+{
+public:
+    BitAdjacency(unsigned int size = 0);
+    ~BitAdjacency();
+
+    // Set methods
+    inline void addEdge(unsigned int u, unsigned int v)
+    {
+        _matrix[u * _words + v / WORD_BITS] |= uint64_t(1) << (v % WORD_BITS);
+        _matrix[v * _words + u / WORD_BITS] |= uint64_t(1) << (u % WORD_BITS);
+    }
+
+    // Get methods
+    inline unsigned int size() const { return _size; }
+    inline unsigned int words() const { return _words; }
+    inline const uint64_t *row(unsigned int v) const { return _matrix.data() + v * _words; }
+
+    // Boolean methods
+    inline bool hasEdge(unsigned int u, unsigned int v) const
+    {
+        return (_matrix[u * _words + v / WORD_BITS] >> (v % WORD_BITS)) & 1;
+    }
+
+    static bool fits(long unsigned int vertices, long unsigned int edges);
+
+    // Bitset methods
+    inline std::vector<uint64_t> emptySet() const { return std::vector<uint64_t>(_words, 0); }
+    std::vector<uint64_t> fullSet() const;
+
+    static inline bool test(const uint64_t *set, unsigned int v)
+    {
+        return (set[v / WORD_BITS] >> (v % WORD_BITS)) & 1;
+    }
+    static inline void set(uint64_t *set, unsigned int v)
+    {
+        set[v / WORD_BITS] |= uint64_t(1) << (v % WORD_BITS);
+    }
+    static inline void reset(uint64_t *set, unsigned int v)
+    {
+        set[v / WORD_BITS] &= ~(uint64_t(1) << (v % WORD_BITS));
+    }
+
+    static inline bool any(const uint64_t *set, unsigned int words)
+    {
+        for (unsigned int i = 0; i < words; i++)
+            if (set[i])
+                return true;
+        return false;
+    }
+    static inline unsigned int count(const uint64_t *set, unsigned int words)
+    {
+        unsigned int count = 0;
+        for (unsigned int i = 0; i < words; i++)
+            count += __builtin_popcountll(set[i]);
+        return count;
+    }
+    static inline unsigned int intersectionCount(const uint64_t *a, const uint64_t *b, unsigned int words)
+    {
+        unsigned int count = 0;
+        for (unsigned int i = 0; i < words; i++)
+            count += __builtin_popcountll(a[i] & b[i]);
+        return count;
+    }
+
+    // dst = a & b
+    static inline void intersect(uint64_t *dst, const uint64_t *a, const uint64_t *b, unsigned int words)
+    {
+        for (unsigned int i = 0; i < words; i++)
+            dst[i] = a[i] & b[i];
+    }
+    // dst = a & ~b
+    static inline void difference(uint64_t *dst, const uint64_t *a, const uint64_t *b, unsigned int words)
+    {
+        for (unsigned int i = 0; i < words; i++)
+            dst[i] = a[i] & ~b[i];
+    }
+
+private:
+    unsigned int _size;
+    unsigned int _words;
+    std::vector<uint64_t> _matrix;
+};
+
+#endif // BIT_ADJACENCY_HPP
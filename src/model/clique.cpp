@@ -6,8 +6,10 @@
  * @date 2022-12-26
  */
 
+#include <algorithm>
+#include <iterator>
+
 #include "clique.hpp"
-#include "../common.hpp"
 
 /**
  * @brief Construct a new Clique:: Clique object
@@ -24,6 +26,92 @@ Clique::~Clique()
 {
 }
 
+/* SET METHODS */
+
+/**
+ * @brief Add a vertex to the clique
+ *
+ * The ids are kept sorted, adding a vertex that is already in the clique does
+ * nothing.
+ *
+ * @param id The id of the vertex to add
+ */
+void Clique::addVertex(VertexId id) // Time complexity: O(k)
+{
+    auto it = std::lower_bound(_vertices.begin(), _vertices.end(), id);
+    if (it != _vertices.end() && *it == id)
+        return;
+    _vertices.insert(it, id);
+    _modified = true;
+}
+
+/**
+ * @brief Add a vertex to the clique and update its weight
+ *
+ * If the weight of the clique is up to date, the weight of the edges between
+ * the vertex and the clique is added to it. Otherwise, or if the vertex is not
+ * adjacent to the whole clique, the weight will be computed by weight().
+ *
+ * @param id The id of the vertex to add
+ * @param graph The graph in which the clique is
+ */
+void Clique::addVertex(VertexId id, const Graph &graph) // Time complexity: O(k)
+{
+    if (hasVertex(id))
+        return;
+
+    std::optional<long unsigned int> gain;
+    if (!_modified)
+        gain = this->gain(id, graph);
+
+    addVertex(id);
+    if (gain)
+    {
+        _weight += gain.value();
+        _modified = false;
+    }
+}
+
+/**
+ * @brief Remove a vertex from the clique
+ *
+ * @param id The id of the vertex to remove
+ */
+void Clique::removeVertex(VertexId id) // Time complexity: O(k)
+{
+    auto it = std::lower_bound(_vertices.begin(), _vertices.end(), id);
+    if (it == _vertices.end() || *it != id)
+        return;
+    _vertices.erase(it);
+    _modified = true;
+}
+
+/**
+ * @brief Remove a vertex from the clique and update its weight
+ *
+ * If the weight of the clique is up to date, the weight of the edges between
+ * the vertex and the rest of the clique is subtracted from it.
+ *
+ * @param id The id of the vertex to remove
+ * @param graph The graph in which the clique is
+ */
+void Clique::removeVertex(VertexId id, const Graph &graph) // Time complexity: O(k)
+{
+    if (!hasVertex(id))
+        return;
+
+    bool modified = _modified;
+    removeVertex(id);
+    if (modified)
+        return;
+
+    for (auto other : _vertices)
+        _weight -= graph.weight(id, other);
+    _modified = false;
+}
+
+/* GET METHODS */
+
 /**
  * @brief Get the weight of the clique
  *
@@ -37,21 +125,17 @@ Clique::~Clique()
  */
 long unsigned int Clique::weight(const Graph &graph)
 {
-    if (_modified && _vertices.size() > 1)
+    if (_modified)
     {
         _weight = 0;
-        auto _vertices = Graph::vertices();
 
         // iterate over all possible pairs of vertices in the clique
         for (auto it = _vertices.begin(); it != _vertices.end(); ++it)
-            for (auto jt = it; jt != _vertices.end(); ++jt)
-                // if the vertices are the same, continue
-                if (it == jt)
-                    continue;
+            for (auto jt = std::next(it); jt != _vertices.end(); ++jt)
                 // if the vertices are connected, add the weight of the edge
                 // to the weight of the clique
-                else if (auto edge = graph.getEdge(*it, *jt))
-                    _weight += edge.value()->weight();
+                if (auto e = graph.findEdge(*it, *jt))
+                    _weight += graph.edge(e.value()).weight();
                 // if the vertices are not connected, the clique is not a clique
                 else
                     return 0;
@@ -59,4 +143,39 @@ long unsigned int Clique::weight(const Graph &graph)
 
     _modified = false;
     return _weight;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Get the weight that adding a vertex would add to the clique
+ *
+ * @param id The id of the vertex to add, which is not in the clique
+ * @param graph The graph in which the clique is
+ * @return std::optional<long unsigned int> The sum of the weights of the edges
+ * between the vertex and the clique, or an empty optional if the vertex is not
+ * adjacent to all the vertices of the clique
+ */
+std::optional<long unsigned int> Clique::gain(VertexId id, const Graph &graph) const // Time complexity: O(k)
+{
+    long unsigned int gain = 0;
+    for (auto other : _vertices)
+    {
+        auto e = graph.findEdge(id, other);
+        if (!e)
+            return {};
+        gain += graph.edge(e.value()).weight();
+    }
+    return gain;
+}
+
+/* BOOLEAN METHODS */
+
+/**
+ * @brief Check if a vertex is in the clique
+ *
+ * @param id The id of the vertex to check
+ * @return true If the vertex is in the clique, false otherwise
+ */
+bool Clique::hasVertex(VertexId id) const // Time complexity: O(log k)
+{
+    return std::binary_search(_vertices.begin(), _vertices.end(), id);
+}
@@ -9,9 +9,9 @@
 #include <memory>
 #include <optional>
 #include <unordered_set>
+#include <vector>
 
 #include "graph.hpp"
-#include "edge.hpp"
 #include "vertex.hpp"
 
 #ifndef CLIQUE_HPP
@@ -21,29 +21,46 @@
  * @brief The Clique class
  *
  * This class represents a clique in a graph. A clique is a subset of vertices
- * that are all connected to each other. It contains a unordered_set of vertices
- * for faster lookup. It also contains the weight of the clique.
- * The weight is not calculated by the class itself, but is set by the user.
+ * that are all connected to each other. It contains the sorted ids of its
+ * vertices, so that copying a clique is a plain copy of integers. It also
+ * contains the weight of the clique.
+ * The weight is computed from the graph on demand by weight(), and cached
+ * until the clique is modified. The methods taking a graph keep the cached
+ * weight up to date in O(k) instead, and gain() tells how much adding a vertex
+ * would add to the weight.
+ *
+ * The methods working with VertexPtr are kept for compatibility, they only
+ * read the id of the vertex.
  */
-class Clique : public Graph
+class Clique
 {
 public:
     Clique();
     ~Clique();
 
     // Set methods
-    inline void addVertex(const VertexPtr &v)
-    {
-        _vertices.insert(v);
-        _modified = true;
-    }
+    void addVertex(VertexId id);
+    void addVertex(VertexId id, const Graph &graph);
+    inline void addVertex(const VertexPtr &v) { addVertex(v->id()); }
+    void removeVertex(VertexId id);
+    void removeVertex(VertexId id, const Graph &graph);
 
     // Get methods
+    inline const std::vector<VertexId> &ids() const { return _vertices; }
+    inline long unsigned int size() const { return _vertices.size(); }
     long unsigned int weight(const Graph &graph);
+    std::optional<long unsigned int> gain(VertexId id, const Graph &graph) const;
+
+    // Boolean methods
+    bool hasVertex(VertexId id) const;
+    inline bool hasVertex(const VertexPtr &v) const { return hasVertex(v->id()); }
+
+    inline bool empty() const { return _vertices.empty(); }
 
 private:
+    std::vector<VertexId> _vertices;
     long unsigned int _weight;
     bool _modified;
 };
 
-#endif // CLIQUE_HPP
\ No newline at end of file
+#endif // CLIQUE_HPP
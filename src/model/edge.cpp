@@ -11,18 +11,23 @@
 /**
  * @brief Construct a new Edge:: Edge object
  *
- * @param first The first vertex
- * @param second The second vertex
+ * @param first The id of the first vertex
+ * @param second The id of the second vertex
  * @param weight The weight of the edge
  */
-Edge::Edge(VertexPtr first, VertexPtr second, unsigned int weight)
+Edge::Edge(VertexId first, VertexId second, unsigned int weight)
     : _first(first), _second(second), _weight(weight)
 {
 }
 
 /**
- * @brief Destroy the Edge:: Edge object
+ * @brief Construct a new Edge:: Edge object
+ *
+ * @param first The first vertex
+ * @param second The second vertex
+ * @param weight The weight of the edge
  */
-Edge::~Edge()
+Edge::Edge(const VertexPtr &first, const VertexPtr &second, unsigned int weight)
+    : Edge(first->id(), second->id(), weight)
 {
 }
\ No newline at end of file
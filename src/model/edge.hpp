@@ -6,6 +6,7 @@
  * @date 2022-12-26
  */
 
+#include <cstdint>
 #include <memory>
 #include <optional>
 
@@ -16,57 +17,61 @@
 
 #define EdgePtr std::shared_ptr<Edge>
 
+// Plain 32-bit handle of an edge: its position in the edge arena of a Graph
+typedef uint32_t EdgeId;
+
 /**
  * @brief The Edge class
  *
- * This class represents an edge in a graph. It contains the two vertices that
- * are connected by the edge and the weight of the edge.
+ * This class represents an edge in a graph. It contains the ids of the two
+ * vertices that are connected by the edge and the weight of the edge, so that
+ * edges can be stored contiguously and copied without any reference counting.
+ *
+ * The vertices are plain ids (VertexId), VertexPtr is only accepted by the
+ * boolean methods, which compare its id without creating any vertex.
  */
 class Edge
 {
 public:
-    Edge(VertexPtr first, VertexPtr second, unsigned int weight);
-    ~Edge();
+    Edge(VertexId first, VertexId second, unsigned int weight);
+    Edge(const VertexPtr &first, const VertexPtr &second, unsigned int weight);
+    ~Edge() = default; // keeps the class trivially copyable
 
     // Get methods
-    inline const VertexPtr first() const { return _first; }
-    inline const VertexPtr second() const { return _second; }
+    inline VertexId firstId() const { return _first; }
+    inline VertexId secondId() const { return _second; }
     inline unsigned int weight() const { return _weight; }
-    inline const std::optional<VertexPtr> getVertex(unsigned int id) const
+    inline const std::optional<VertexId> otherId(VertexId id) const
     {
-        if (_first->id() == id)
-            return _first;
-        if (_second->id() == id)
+        if (_first == id)
             return _second;
+        if (_second == id)
+            return _first;
         return {};
     }
-    inline const std::optional<VertexPtr> otherVertex(unsigned int id) const
-    {
-        if (auto v = getVertex(id))
-            return *v == _first ? _second : _first;
-        return {};
-    }
-    inline const std::optional<VertexPtr> otherVertex(const VertexPtr &v) const { return otherVertex(v->id()); }
+
+    // Set methods
+    inline void setWeight(unsigned int weight) { _weight = weight; }
 
     // Boolean methods
     inline bool operator==(const Edge &e) const { return _first == e._first && _second == e._second && _weight == e._weight; }
     inline bool operator<(const Edge &e) const { return _weight < e._weight; }
 
-    inline bool hasVertex(unsigned int id) const { return getVertex(id).has_value(); }
+    inline bool hasVertex(unsigned int id) const { return _first == id || _second == id; }
     inline bool hasVertex(const VertexPtr &v) const { return hasVertex(v->id()); }
 
     inline bool isIncident(unsigned int first_id, unsigned int second_id) const
     {
-        if (auto _second = otherVertex(first_id))
-            return _second.value()->id() == second_id;
+        if (auto other = otherId(first_id))
+            return other.value() == second_id;
         return false;
     }
     inline bool isIncident(const VertexPtr &first, const VertexPtr &second) const { return isIncident(first->id(), second->id()); }
-    inline bool isIncident(const EdgePtr &e) const { return isIncident(e->first(), e->second()); }
+    inline bool isIncident(const EdgePtr &e) const { return isIncident(e->firstId(), e->secondId()); }
 
 private:
-    VertexPtr _first;
-    VertexPtr _second;
+    VertexId _first;
+    VertexId _second;
     unsigned int _weight;
 };
 
@@ -84,8 +89,8 @@ namespace std
     {
         std::size_t operator()(const Edge &e) const
         {
-            return hash<unsigned int>()(e.first()->id()) ^
-                   hash<unsigned int>()(e.second()->id()) ^
+            return hash<unsigned int>()(e.firstId()) ^
+                   hash<unsigned int>()(e.secondId()) ^
                    hash<unsigned int>()(e.weight());
         }
     };
@@ -0,0 +1,325 @@
+/**
+ * @file frozen_graph.cpp
+ * @brief Implementation of the FrozenGraph class
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <algorithm>
+#include <tuple>
+
+#include "frozen_graph.hpp"
+
+/**
+ * @brief Construct a new FrozenGraph:: FrozenGraph object
+ *
+ * This constructor takes a snapshot of the graph. The vertices are given dense
+ * indices in increasing order of their ids and the adjacency is stored in the
+ * CSR format with the neighbors of each vertex sorted by index.
+ *
+ * The time complexity of this constructor is O(n + m log m), where n is the
+ * highest id and m the number of edges of the graph.
+ *
+ * @param graph The graph to freeze
+ */
+FrozenGraph::FrozenGraph(const Graph &graph)
+{
+    // Walk the vertex directory of the graph in increasing order of ids to get
+    // the dense indices
+    _vertices.reserve(graph.size());
+    for (unsigned int id = 0; id < graph.idBound(); id++)
+        if (graph.hasVertex(id))
+            _vertices.push_back(id);
+
+    unsigned int max_id = _vertices.empty() ? 0 : _vertices.back();
+    _indices.assign(max_id + 1, size());
+    for (unsigned int i = 0; i < size(); i++)
+        _indices[_vertices[i]] = i;
+
+    // Gather both directions of every edge as (source, destination, weight)
+    std::vector<std::tuple<unsigned int, unsigned int, unsigned int>> arcs;
+    arcs.reserve(2 * graph.edges().size());
+    for (const auto &edge : graph.edges())
+    {
+        auto first = index(edge.firstId());
+        auto second = index(edge.secondId());
+        if (!first || !second || first == second)
+            continue;
+        arcs.emplace_back(first.value(), second.value(), edge.weight());
+        arcs.emplace_back(second.value(), first.value(), edge.weight());
+    }
+    std::sort(arcs.begin(), arcs.end());
+
+    // Fill the CSR arrays
+    _offsets.assign(size() + 1, 0);
+    _neighbors.reserve(arcs.size());
+    _weights.reserve(arcs.size());
+    for (const auto &[source, destination, weight] : arcs)
+    {
+        _offsets[source + 1]++;
+        _neighbors.push_back(destination);
+        _weights.push_back(weight);
+    }
+    for (unsigned int i = 0; i < size(); i++)
+        _offsets[i + 1] += _offsets[i];
+
+    sumWeights();
+    packWeights();
+}
+
+/**
+ * @brief Construct a new FrozenGraph:: FrozenGraph object
+ *
+ * This constructor takes a snapshot of the subgraph of a frozen graph induced
+ * by some of its vertices. The vertices are given new dense indices, still in
+ * increasing order of their ids, so a component of a large graph gets a small
+ * graph of its own (with its own bit matrix and weight matrix).
+ *
+ * The id -> index table is not built, so that it doesn't take O(n) for each
+ * subgraph: index() searches the vertices instead.
+ *
+ * The time complexity of this constructor is O(k + d log k), where k is the
+ * number of vertices and d the sum of their degrees in the graph.
+ *
+ * @param graph The frozen graph
+ * @param vertices The sorted indices of the vertices of the subgraph
+ */
+FrozenGraph::FrozenGraph(const FrozenGraph &graph, const std::vector<unsigned int> &vertices)
+{
+    _vertices.reserve(vertices.size());
+    for (auto v : vertices)
+        _vertices.push_back(graph.id(v));
+
+    // The neighbors of each vertex stay sorted once renumbered, since the new
+    // indices are in the same order as the old ones
+    _offsets.assign(size() + 1, 0);
+    for (unsigned int i = 0; i < size(); i++)
+    {
+        auto neighbors = graph.neighbors(vertices[i]);
+        auto weights = graph.weights(vertices[i]);
+        for (long unsigned int j = 0; j < neighbors.size(); j++)
+        {
+            auto it = std::lower_bound(vertices.begin(), vertices.end(), neighbors[j]);
+            if (it == vertices.end() || *it != neighbors[j])
+                continue;
+            _neighbors.push_back(it - vertices.begin());
+            _weights.push_back(weights[j]);
+        }
+        _offsets[i + 1] = _neighbors.size();
+    }
+
+    sumWeights();
+    packWeights();
+}
+
+/**
+ * @brief Destroy the FrozenGraph:: FrozenGraph object
+ */
+FrozenGraph::~FrozenGraph()
+{
+}
+
+/**
+ * @brief Compute the weighted degree of each vertex
+ */
+void FrozenGraph::sumWeights() // Time complexity: O(n + m)
+{
+    _weightedDegrees.assign(size(), 0);
+    for (unsigned int u = 0; u < size(); u++)
+        for (long unsigned int i = _offsets[u]; i < _offsets[u + 1]; i++)
+            _weightedDegrees[u] += _weights[i];
+}
+
+/**
+ * @brief Pack the weights of the graph in a WeightMatrix if it is worth it
+ *
+ * The matrix is only built for dense graphs whose weights are all between 1
+ * and MAX_PACKED_WEIGHT.
+ */
+void FrozenGraph::packWeights() // Time complexity: O(n^2 + m)
+{
+    if (!WeightMatrix::fits(size(), edgeCount()))
+        return;
+    for (auto weight : _weights)
+        if (weight < 1 || weight > MAX_PACKED_WEIGHT)
+            return;
+
+    _weightMatrix = WeightMatrix(size());
+    for (unsigned int u = 0; u < size(); u++)
+        for (long unsigned int i = _offsets[u]; i < _offsets[u + 1]; i++)
+            _weightMatrix->setWeight(u, _neighbors[i], _weights[i]);
+}
+
+/* GET METHODS */
+
+/**
+ * @brief Get the index of a vertex from its id
+ *
+ * @param id The id of the vertex
+ * @return std::optional<unsigned int> The index of the vertex if it exists,
+ * an empty optional otherwise
+ */
+std::optional<unsigned int> FrozenGraph::index(unsigned int id) const // Time complexity: O(1) or O(log n)
+{
+    // Induced subgraphs don't have the table, but their vertices are sorted
+    if (_indices.empty())
+    {
+        auto it = std::lower_bound(_vertices.begin(), _vertices.end(), id);
+        if (it == _vertices.end() || *it != id)
+            return {};
+        return it - _vertices.begin();
+    }
+
+    if (id < _indices.size() && _indices[id] != size())
+        return _indices[id];
+    return {};
+}
+
+/**
+ * @brief Get the weight of the edge between two vertices
+ *
+ * @param u The index of the first vertex
+ * @param v The index of the second vertex
+ * @return unsigned int The weight of the edge, 0 if there is no edge
+ */
+unsigned int FrozenGraph::weight(unsigned int u, unsigned int v) const // Time complexity: O(1) or O(log d(u))
+{
+    if (_weightMatrix)
+        return _weightMatrix->weight(u, v);
+
+    auto neighbors = this->neighbors(u);
+    auto it = std::lower_bound(neighbors.begin(), neighbors.end(), v);
+    if (it == neighbors.end() || *it != v)
+        return 0;
+    return _weights[_offsets[u] + (it - neighbors.begin())];
+}
+
+/**
+ * @brief Get the weight of a clique
+ *
+ * This function calculates the weight of a set of vertices. If the set is not
+ * a clique, it returns 0, like Clique::weight.
+ *
+ * @param clique The indices of the vertices of the clique
+ * @return long unsigned int The weight of the clique
+ */
+long unsigned int FrozenGraph::weight(const std::vector<unsigned int> &clique) const // Time complexity: O(k^2 log n)
+{
+    long unsigned int weight = 0;
+    for (auto it = clique.begin(); it != clique.end(); ++it)
+        for (auto jt = std::next(it); jt != clique.end(); ++jt)
+        {
+            unsigned int edge_weight = this->weight(*it, *jt);
+            if (edge_weight == 0 && !hasEdge(*it, *jt))
+                return 0;
+            weight += edge_weight;
+        }
+    return weight;
+}
+
+/**
+ * @brief Get the adjacency matrix of the graph as a bit matrix
+ *
+ * The rows of the bit matrix are indexed by the dense indices of the vertices.
+ *
+ * @return BitAdjacency The bit matrix of the graph
+ */
+BitAdjacency FrozenGraph::bitAdjacency() const // Time complexity: O(n^2 / 64 + m)
+{
+    BitAdjacency adjacency(size());
+    for (unsigned int u = 0; u < size(); u++)
+        for (auto v : neighbors(u))
+            if (u < v)
+                adjacency.addEdge(u, v);
+    return adjacency;
+}
+
+/**
+ * @brief Get the connected components of the graph
+ *
+ * The components are found with a breadth-first search from each vertex that
+ * hasn't been reached yet, then gathered by a single pass over the vertices so
+ * that the indices of each component come out sorted.
+ *
+ * @return std::vector<std::vector<unsigned int>> The sorted indices of the
+ * vertices of each component, in increasing order of their first vertex
+ */
+std::vector<std::vector<unsigned int>> FrozenGraph::components() const // Time complexity: O(n + m)
+{
+    std::vector<unsigned int> component(size(), size());
+    std::vector<unsigned int> queue;
+    queue.reserve(size());
+    unsigned int count = 0;
+    for (unsigned int source = 0; source < size(); source++)
+    {
+        if (component[source] != size())
+            continue;
+
+        component[source] = count;
+        queue.assign(1, source);
+        for (long unsigned int head = 0; head < queue.size(); head++)
+            for (auto v : neighbors(queue[head]))
+                if (component[v] == size())
+                {
+                    component[v] = count;
+                    queue.push_back(v);
+                }
+        count++;
+    }
+
+    std::vector<std::vector<unsigned int>> components(count);
+    for (unsigned int v = 0; v < size(); v++)
+        components[component[v]].push_back(v);
+    return components;
+}
+
+/**
+ * @brief Convert a set of indices to a Clique
+ *
+ * @param indices The indices of the vertices of the clique
+ * @return Clique The clique made of the corresponding vertices
+ */
+Clique FrozenGraph::clique(const std::vector<unsigned int> &indices) const // Time complexity: O(k)
+{
+    Clique clique;
+    for (auto v : indices)
+        clique.addVertex(_vertices[v]);
+    return clique;
+}
+
+/**
+ * @brief Convert a Clique to the sorted indices of its vertices
+ *
+ * The vertices of the clique that are not in the graph are ignored.
+ *
+ * @param clique The clique
+ * @return std::vector<unsigned int> The sorted indices of the vertices of the clique
+ */
+std::vector<unsigned int> FrozenGraph::indices(const Clique &clique) const // Time complexity: O(k log k)
+{
+    std::vector<unsigned int> indices;
+    for (auto id : clique.ids())
+        if (auto i = index(id))
+            indices.push_back(i.value());
+    std::sort(indices.begin(), indices.end());
+    return indices;
+}
+
+/* BOOLEAN METHODS */
+
+/**
+ * @brief Check if an edge is in the graph
+ *
+ * @param u The index of the first vertex
+ * @param v The index of the second vertex
+ * @return true If the edge is in the graph, false otherwise
+ */
+bool FrozenGraph::hasEdge(unsigned int u, unsigned int v) const // Time complexity: O(1) or O(log d(u))
+{
+    if (_weightMatrix)
+        return _weightMatrix->hasEdge(u, v);
+
+    auto neighbors = this->neighbors(u);
+    return std::binary_search(neighbors.begin(), neighbors.end(), v);
+}
@@ -0,0 +1,114 @@
+/**
+ * @file frozen_graph.hpp
+ * @brief Declaration of the FrozenGraph class
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <optional>
+#include <vector>
+
+#include "bit_adjacency.hpp"
+#include "clique.hpp"
+#include "graph.hpp"
+#include "vertex.hpp"
+#include "weight_matrix.hpp"
+
+#ifndef FROZEN_GRAPH_HPP
+#define FROZEN_GRAPH_HPP
+
+/**
+ * @brief A read-only range over a contiguous array
+ *
+ * This is a minimal view used to iterate over the neighbors and the weights
+ * of a vertex in a FrozenGraph without copying them.
+ */
+template <typename T>
+class Range
+{
+public:
+    Range(const T *begin, const T *end) : _begin(begin), _end(end) {}
+
+    inline const T *begin() const { return _begin; }
+    inline const T *end() const { return _end; }
+    inline long unsigned int size() const { return _end - _begin; }
+    inline bool empty() const { return _begin == _end; }
+    inline const T &operator[](long unsigned int i) const { return _begin[i]; }
+
+private:
+    const T *_begin;
+    const T *_end;
+};
+
+/**
+ * @brief The FrozenGraph class
+ *
+ * This class is an immutable snapshot of a Graph stored in the compressed
+ * sparse row (CSR) format. The vertices are renumbered with dense indices
+ * from 0 to n - 1 in increasing order of their ids, and the neighbors of each
+ * vertex are stored sorted in a single contiguous array along with the
+ * weights of the corresponding edges.
+ *
+ * It is meant to be built once after reading the input file and then shared
+ * by the algorithms, which work on the indices instead of the ids.
+ *
+ * The sum of the weights of the edges of each vertex (its weighted degree) is
+ * computed once by the constructors, like its degree.
+ *
+ * On dense graphs whose weights fit in a byte, the weights are also packed in
+ * a WeightMatrix so that weight() and hasEdge() are O(1) lookups.
+ */
+class FrozenGraph
+{
+public:
+    FrozenGraph(const Graph &graph);
+    FrozenGraph(const FrozenGraph &graph, const std::vector<unsigned int> &vertices);
+    ~FrozenGraph();
+
+    // Get methods
+    inline unsigned int size() const { return _vertices.size(); }
+    inline long unsigned int edgeCount() const { return _neighbors.size() / 2; }
+
+    inline VertexId id(unsigned int v) const { return _vertices[v]; }
+    std::optional<unsigned int> index(unsigned int id) const;
+
+    inline unsigned int degree(unsigned int v) const { return _offsets[v + 1] - _offsets[v]; }
+    inline long unsigned int weightedDegree(unsigned int v) const { return _weightedDegrees[v]; }
+    inline Range<unsigned int> neighbors(unsigned int v) const
+    {
+        return Range<unsigned int>(_neighbors.data() + _offsets[v], _neighbors.data() + _offsets[v + 1]);
+    }
+    inline Range<unsigned int> weights(unsigned int v) const
+    {
+        return Range<unsigned int>(_weights.data() + _offsets[v], _weights.data() + _offsets[v + 1]);
+    }
+
+    unsigned int weight(unsigned int u, unsigned int v) const;
+    long unsigned int weight(const std::vector<unsigned int> &clique) const;
+
+    BitAdjacency bitAdjacency() const;
+    std::vector<std::vector<unsigned int>> components() const;
+
+    Clique clique(const std::vector<unsigned int> &indices) const;
+    std::vector<unsigned int> indices(const Clique &clique) const;
+
+    // Boolean methods
+    bool hasEdge(unsigned int u, unsigned int v) const;
+
+    inline bool empty() const { return _vertices.empty(); }
+
+private:
+    void sumWeights();
+    void packWeights();
+
+    std::vector<VertexId> _vertices;        // index -> id
+    std::vector<unsigned int> _indices;     // id -> index (or size() if the id is unused), empty for induced subgraphs
+    std::vector<long unsigned int> _offsets; // index -> first neighbor in _neighbors
+    std::vector<unsigned int> _neighbors;   // sorted neighbor indices of each vertex
+    std::vector<unsigned int> _weights;     // weight of the edge to each neighbor
+    std::vector<long unsigned int> _weightedDegrees; // index -> sum of the weights of its edges
+    std::optional<WeightMatrix> _weightMatrix; // packed weights of dense graphs
+};
+
+#endif // FROZEN_GRAPH_HPP
@@ -6,10 +6,10 @@
  * @date 2022-12-26
  */
 
+#include <algorithm>
 #include <iostream>
 
 #include "graph.hpp"
-#include "../common.hpp"
 
 /**
  * @brief Construct a new Graph:: Graph object
@@ -25,29 +25,74 @@ Graph::~Graph()
 {
 }
 
-/* GET METHODS */
+/* SET METHODS */
 
 /**
- * @brief Get a vertex from the graph
+ * @brief Add a vertex to the graph
  *
- * This method returns a vertex from the graph if it exists. If it does, it returns
- * the vertex as an optional. If it does not, it returns an empty optional.
+ * The directory and the bitmap grow up to the id of the vertex. Adding a
+ * vertex whose id is already in use does nothing.
  *
- * @param id The id of the vertex
- * @return std::optional<VertexPtr> The vertex if it exists,
- * an empty optional otherwise
+ * @param id The id of the vertex to add
  */
-const std::optional<VertexPtr> Graph::getVertex(unsigned int id) const // Time complexity: O(1)
+void Graph::addVertex(VertexId id) // Time complexity: O(1) amortized
 {
-    VertexPtr v = std::make_shared<Vertex>(id);
-    if (_vertices.find(v) != _vertices.end())
-        return *_vertices.find(v);
-    return {};
+    if (hasVertex(id))
+        return;
+
+    if (id >= _directory.size())
+    {
+        _directory.resize(id + 1, NO_VERTEX);
+        _present.resize((id + WORD_BITS) / WORD_BITS, 0);
+    }
+
+    _directory[id] = _vertices.size();
+    BitAdjacency::set(_present.data(), id);
+    _vertices.push_back(id);
+
+    _byDegreeValid = false;
+    _byWeightedDegreeValid = false;
 }
 
+/**
+ * @brief Add an edge to the graph
+ *
+ * The edge is appended to the edge arena and referenced in both directions in
+ * the adjacency matrix (simple undirected graphs, no parallel edges). If the
+ * vertices are already connected, the weight of their edge is replaced. The
+ * degrees of both vertices are updated accordingly.
+ *
+ * @param first_id The id of the first vertex of the edge
+ * @param second_id The id of the second vertex of the edge
+ * @param weight The weight of the edge
+ * @return EdgeId The id of the edge
+ */
+EdgeId Graph::addEdge(VertexId first_id, VertexId second_id, unsigned int weight) // Time complexity: O(1)
+{
+    if (auto e = findEdge(first_id, second_id))
+    {
+        Edge &edge = _edges[e.value()];
+        updateDegrees(first_id, second_id, 0, static_cast<long int>(weight) - edge.weight());
+        edge.setWeight(weight);
+        return e.value();
+    }
+
+    EdgeId e = _edges.size();
+    _edges.emplace_back(first_id, second_id, weight);
+    _adjacencyMatrix[first_id][second_id] = e;
+    _adjacencyMatrix[second_id][first_id] = e;
+    updateDegrees(first_id, second_id, 1, weight);
+    return e;
+}
+
+/* GET METHODS */
+
 /**
  * @brief Get an edge from the graph
  *
+ * This method is kept for compatibility: it returns a copy of the edge, use
+ * findEdge() and edge() to access it in place.
+ *
  * @param first_id The id of the first vertex of the edge
  * @param second_id The id of the second vertex of the edge
  * @return std::optional<EdgePtr> The edge if it exists,
@@ -56,15 +101,9 @@ const std::optional<EdgePtr> Graph::getEdge(
     unsigned int first_id,
     unsigned int second_id) const // Time complexity: O(1)
 {
-    try
-    {
-        return _adjacencyMatrix.at(first_id).at(second_id);
-    }
-    catch (const std::out_of_range &e)
-    {
-        UNUSED(e);
-        return {};
-    }
+    if (auto e = findEdge(first_id, second_id))
+        return std::make_shared<Edge>(_edges[e.value()]);
+    return {};
 }
 
 /**
@@ -85,30 +124,243 @@ const std::optional<EdgePtr> Graph::getEdge(
     return getEdge(first->id(), second->id());
 }
 
-/* BOOLEAN METHODS */
+/**
+ * @brief Find an edge of the graph
+ *
+ * @param first_id The id of the first vertex of the edge
+ * @param second_id The id of the second vertex of the edge
+ * @return std::optional<EdgeId> The id of the edge if it exists,
+ * an empty optional otherwise
+ */
+const std::optional<EdgeId> Graph::findEdge(VertexId first_id, VertexId second_id) const // Time complexity: O(1)
+{
+    auto row = _adjacencyMatrix.find(first_id);
+    if (row == _adjacencyMatrix.end())
+        return {};
+    auto e = row->second.find(second_id);
+    if (e == row->second.end())
+        return {};
+    return e->second;
+}
+
+/**
+ * @brief Get the neighbors of a vertex
+ *
+ * This method returns a reference to the row of the adjacency matrix of the
+ * vertex, which maps the ids of its neighbors to the edges leading to them.
+ * It does not copy anything, and a vertex without neighbors gets an empty row.
+ *
+ * @param id The id of the vertex
+ * @return const std::unordered_map<VertexId, EdgeId>& The neighbors of the vertex
+ */
+const std::unordered_map<VertexId, EdgeId> &Graph::neighbors(unsigned int id) const // Time complexity: O(1)
+{
+    static const std::unordered_map<VertexId, EdgeId> no_neighbors;
+
+    auto row = _adjacencyMatrix.find(id);
+    if (row == _adjacencyMatrix.end())
+        return no_neighbors;
+    return row->second;
+}
+
+/**
+ * @brief Count the vertices of the graph in a range of ids
+ *
+ * The ids are counted a word of the bitmap at a time.
+ *
+ * @param first_id The first id of the range
+ * @param last_id The id following the last id of the range
+ * @return long unsigned int The number of ids of the range in use
+ */
+long unsigned int Graph::countVertices(unsigned int first_id, unsigned int last_id) const // Time complexity: O((last_id - first_id) / 64)
+{
+    last_id = std::min(last_id, idBound());
+    if (first_id >= last_id)
+        return 0;
+
+    unsigned int first_word = first_id / WORD_BITS;
+    unsigned int last_word = (last_id - 1) / WORD_BITS;
+    uint64_t first_mask = ~uint64_t(0) << (first_id % WORD_BITS);
+    uint64_t last_mask = ~uint64_t(0) >> (WORD_BITS - 1 - (last_id - 1) % WORD_BITS);
+
+    if (first_word == last_word)
+        return __builtin_popcountll(_present[first_word] & first_mask & last_mask);
+
+    long unsigned int count = __builtin_popcountll(_present[first_word] & first_mask);
+    for (unsigned int i = first_word + 1; i < last_word; i++)
+        count += __builtin_popcountll(_present[i]);
+    return count + __builtin_popcountll(_present[last_word] & last_mask);
+}
+
+/**
+ * @brief Get the vertices sorted by decreasing degree
+ *
+ * Vertices of the same degree are sorted by increasing id. The order is
+ * computed on the first call after a modification of the graph and then
+ * reused.
+ *
+ * @return const std::vector<VertexId>& The ids of the sorted vertices
+ */
+const std::vector<VertexId> &Graph::verticesByDegree() const // Time complexity: O(n log n), O(1) if cached
+{
+    if (!_byDegreeValid)
+    {
+        _byDegree.clear();
+        for (auto v : _vertices)
+            _byDegree.push_back(v);
+        std::sort(_byDegree.begin(), _byDegree.end(), [this](VertexId a, VertexId b)
+                  { return degree(a) != degree(b) ? degree(a) > degree(b) : a < b; });
+        _byDegreeValid = true;
+    }
+    return _byDegree;
+}
+
+/**
+ * @brief Get the vertices sorted by decreasing weighted degree
+ *
+ * Vertices of the same weighted degree are sorted by increasing id. Like
+ * verticesByDegree(), the order is cached until the graph is modified.
+ *
+ * @return const std::vector<VertexId>& The ids of the sorted vertices
+ */
+const std::vector<VertexId> &Graph::verticesByWeightedDegree() const // Time complexity: O(n log n), O(1) if cached
+{
+    if (!_byWeightedDegreeValid)
+    {
+        _byWeightedDegree.clear();
+        for (auto v : _vertices)
+            _byWeightedDegree.push_back(v);
+        std::sort(_byWeightedDegree.begin(), _byWeightedDegree.end(), [this](VertexId a, VertexId b)
+                  { return weightedDegree(a) != weightedDegree(b) ? weightedDegree(a) > weightedDegree(b) : a < b; });
+        _byWeightedDegreeValid = true;
+    }
+    return _byWeightedDegree;
+}
+
+/**
+ * @brief Get the weight of an edge of the graph
+ *
+ * This method never throws: a missing edge simply has a weight of 0.
+ *
+ * @param first_id The id of the first vertex of the edge
+ * @param second_id The id of the second vertex of the edge
+ * @return unsigned int The weight of the edge if it exists, 0 otherwise
+ */
+unsigned int Graph::weight(unsigned int first_id, unsigned int second_id) const // Time complexity: O(1)
+{
+    if (auto e = findEdge(first_id, second_id))
+        return _edges[e.value()].weight();
+    return 0;
+}
 
 /**
- * @brief Check if a vertex is in the graph
+ * @brief Get the weight of an edge of the graph
  *
- * @param id The id of the vertex to check
- * @return true If the vertex is in the graph, false otherwise
+ * @param first The first vertex of the edge
+ * @param second The second vertex of the edge
+ * @return unsigned int The weight of the edge if it exists, 0 otherwise
  */
-bool Graph::hasVertex(unsigned int id) const // Time complexity: O(1)
+unsigned int Graph::weight(const VertexPtr &first, const VertexPtr &second) const // Time complexity: O(1)
 {
-    if (getVertex(id))
-        return true;
-    return false;
+    return weight(first->id(), second->id());
 }
 
 /**
- * @brief Check if a vertex is in the graph
+ * @brief Get the core number of every vertex of the graph
+ *
+ * The core number of a vertex is the largest k such that the vertex belongs to
+ * a subgraph where every vertex has at least k neighbors (its k-core). A clique
+ * of k vertices is in the (k - 1)-core, so a vertex of core number c can't be in
+ * a clique of more than c + 1 vertices.
  *
- * @param v The vertex to check
- * @return true If the vertex is in the graph, false otherwise
+ * The vertices are peeled by increasing degree with the bucket algorithm of
+ * Batagelj and Zaversnik. Loops are ignored.
+ *
+ * @return std::vector<unsigned int> The core number of each vertex, indexed by
+ * id (0 for the absent ids)
  */
-bool Graph::hasVertex(const VertexPtr &v) const // Time complexity: O(1)
+std::vector<unsigned int> Graph::coreNumbers() const // Time complexity: O(n + m)
 {
-    return hasVertex(v->id());
+    std::vector<unsigned int> cores(idBound(), 0);
+    unsigned int max_degree = 0;
+    for (auto v : _vertices)
+    {
+        cores[v] = degree(v) - (hasEdge(v, v) ? 1 : 0);
+        max_degree = std::max(max_degree, cores[v]);
+    }
+
+    // Sort the vertices by degree with a counting sort, bins[d] being the
+    // position of the first vertex of degree d
+    std::vector<unsigned int> bins(max_degree + 1, 0);
+    for (auto v : _vertices)
+        bins[cores[v]]++;
+    unsigned int start = 0;
+    for (auto &bin : bins)
+    {
+        unsigned int count = bin;
+        bin = start;
+        start += count;
+    }
+    std::vector<VertexId> order(size());
+    std::vector<unsigned int> positions(idBound(), 0);
+    std::vector<unsigned int> next(bins);
+    for (auto v : _vertices)
+    {
+        positions[v] = next[cores[v]]++;
+        order[positions[v]] = v;
+    }
+
+    // Peel the vertex of smallest degree, its degree being its core number,
+    // and decrement the degrees of its neighbors of higher degree
+    for (auto v : order)
+        for (const auto &[u, e] : neighbors(v))
+        {
+            if (cores[u] <= cores[v])
+                continue;
+
+            // Swap u with the first vertex of its bin and shrink the bin
+            VertexId first = order[bins[cores[u]]];
+            if (first != u)
+            {
+                std::swap(order[positions[u]], order[bins[cores[u]]]);
+                std::swap(positions[u], positions[first]);
+            }
+            bins[cores[u]]++;
+            cores[u]--;
+        }
+    return cores;
+}
+
+/**
+ * @brief Get the adjacency matrix of the graph as a bit matrix
+ *
+ * The rows of the bit matrix are indexed by the ids of the vertices, so it has
+ * idBound() rows.
+ *
+ * @return BitAdjacency The bit matrix of the graph
+ */
+BitAdjacency Graph::bitAdjacency() const // Time complexity: O(n^2 / 64 + m)
+{
+    BitAdjacency adjacency(idBound());
+    for (const auto &edge : _edges)
+        adjacency.addEdge(edge.firstId(), edge.secondId());
+    return adjacency;
+}
+
+/* BOOLEAN METHODS */
+
+/**
+ * @brief Check if a set of vertices is in the graph
+ *
+ * @param ids The ids of the vertices to check
+ * @return true If all the vertices are in the graph, false otherwise
+ */
+bool Graph::hasVertices(const std::vector<VertexId> &ids) const // Time complexity: O(k)
+{
+    for (auto id : ids)
+        if (!hasVertex(id))
+            return false;
+    return true;
 }
 
 /**
@@ -120,9 +372,7 @@ bool Graph::hasVertex(const VertexPtr &v) const // Time complexity: O(1)
  */
 bool Graph::hasEdge(unsigned int first_id, unsigned int second_id) const // Time complexity: O(1)
 {
-    if (getEdge(first_id, second_id))
-        return true;
-    return false;
+    return findEdge(first_id, second_id).has_value();
 }
 
 /**
@@ -145,7 +395,7 @@ bool Graph::hasEdge(const VertexPtr &first, const VertexPtr &second) const // Ti
  */
 bool Graph::hasEdge(const EdgePtr &e) const // Time complexity: O(1)
 {
-    return hasEdge(e->first(), e->second());
+    return hasEdge(e->firstId(), e->secondId());
 }
 
 /* REMOVE METHODS */
@@ -154,38 +404,46 @@ bool Graph::hasEdge(const EdgePtr &e) const // Time complexity: O(1)
  * @brief Remove a vertex from the graph and all its incident edges
  *
  * @param id The id of the vertex to remove
- * @return std::optional<VertexPtr> The vertex if it was removed, an empty optional otherwise
+ * @return std::optional<VertexId> The id of the vertex if it was removed, an empty optional otherwise
  */
-const std::optional<VertexPtr> Graph::removeVertex(unsigned int id)
+const std::optional<VertexId> Graph::removeVertex(unsigned int id)
 {
     // If the vertex does not exist, do nothing
     if (!hasVertex(id))
         return {};
 
-    // Get the vertex
-    VertexPtr v = getVertex(id).value();
+    // Delete the vertex from the list of vertices by moving the last vertex
+    // of the list into its position
+    unsigned int position = _directory[id];
+    _vertices[position] = _vertices.back();
+    _directory[_vertices[position]] = position;
+    _vertices.pop_back();
+    _directory[id] = NO_VERTEX;
+    BitAdjacency::reset(_present.data(), id);
+    _byDegreeValid = false;
+    _byWeightedDegreeValid = false;
 
-    // Delete the vertex from the set of vertices
-    _vertices.erase(v);
-
-    // Delete the vertex from the adjacency matrix and the set of edges
-    for (const auto &[neighbor, edge] : _adjacencyMatrix[id])
-    {
-        _adjacencyMatrix[neighbor].erase(id);
-        _edges.erase(edge);
-    }
+    // Delete the incident edges from the adjacency matrix and the edge arena
+    std::vector<EdgeId> incident;
+    for (const auto &[neighbor, e] : neighbors(id))
+        incident.push_back(e);
+    // Erase the edges from the end of the arena first, so that the ids of the
+    // edges left to erase are not changed by the compaction
+    std::sort(incident.rbegin(), incident.rend());
+    for (auto e : incident)
+        eraseEdge(e);
     _adjacencyMatrix.erase(id);
 
-    return v;
+    return id;
 }
 
 /**
  * @brief Remove a vertex from the graph and all its incident edges
  *
  * @param v The vertex to remove
- * @return std::optional<VertexPtr> The vertex if it was removed, an empty optional otherwise
+ * @return std::optional<VertexId> The id of the vertex if it was removed, an empty optional otherwise
  */
-const std::optional<VertexPtr> Graph::removeVertex(const VertexPtr &v)
+const std::optional<VertexId> Graph::removeVertex(const VertexPtr &v)
 {
     return removeVertex(v->id());
 }
@@ -200,12 +458,12 @@ const std::optional<VertexPtr> Graph::removeVertex(const VertexPtr &v)
 const std::optional<EdgePtr> Graph::removeEdge(unsigned int first_id, unsigned int second_id)
 {
     // Check if the edge exists
-    if (!hasEdge(first_id, second_id))
+    auto e = findEdge(first_id, second_id);
+    if (!e)
         return {};
 
-    EdgePtr edge = getEdge(first_id, second_id).value();
-    _adjacencyMatrix[first_id].erase(second_id);
-    _adjacencyMatrix[second_id].erase(first_id);
+    EdgePtr edge = std::make_shared<Edge>(_edges[e.value()]);
+    eraseEdge(e.value());
 
     return edge;
 }
@@ -230,5 +488,183 @@ const std::optional<EdgePtr> Graph::removeEdge(const VertexPtr &first, const Ver
  */
 const std::optional<EdgePtr> Graph::removeEdge(const EdgePtr &e)
 {
-    return removeEdge(e->first(), e->second());
+    return removeEdge(e->firstId(), e->secondId());
+}
+
+/**
+ * @brief Remove the vertices and the edges that can't be in a clique of weight
+ * at least a lower bound
+ *
+ * The lower bound is the weight of a known clique, typically found by a
+ * heuristic, so that only the cliques at least as heavy have to be searched.
+ * Every clique whose weight is at least the lower bound is kept, the known one
+ * included.
+ *
+ * A vertex v of core number c is in cliques of at most c + 1 vertices, in which
+ * each vertex u has at most c incident edges. Let S(u) be the sum of the c
+ * heaviest edges of u: the weight of a clique with v, which is half the sum of
+ * the weights of the edges of its vertices, is at most half of S(v) plus the c
+ * greatest S(u) among the neighbors u of v. The vertex is removed when this
+ * bound is below the lower bound.
+ *
+ * An edge in no triangle is only in the clique made of its two vertices, so it
+ * is removed when its weight is below the lower bound. The isolated vertices
+ * are removed as long as there are edges left, since an edge is heavier.
+ *
+ * The removals lower the bounds of the other vertices, so the reductions are
+ * repeated until none applies.
+ *
+ * @param lower_bound The weight of a known clique
+ * @return KernelReport What was removed from the graph
+ */
+KernelReport Graph::kernelize(long unsigned int lower_bound) // Time complexity: O(r * (m log n + sum of d(u) * d(v) over the edges))
+{
+    KernelReport report;
+    long unsigned int initial_vertices = size();
+    long unsigned int initial_edges = _edges.size();
+
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        report.rounds++;
+
+        // Sum of the c heaviest incident edges of each vertex, for every c
+        std::vector<unsigned int> cores = coreNumbers(); // O(n + m)
+        std::vector<std::vector<long unsigned int>> heaviest(idBound());
+        for (auto v : _vertices)
+        {
+            std::vector<long unsigned int> &sums = heaviest[v];
+            for (const auto &[u, e] : neighbors(v))
+                if (u != v)
+                    sums.push_back(_edges[e].weight());
+            std::sort(sums.begin(), sums.end(), std::greater<long unsigned int>());
+            sums.insert(sums.begin(), 0);
+            for (long unsigned int i = 1; i < sums.size(); i++)
+                sums[i] += sums[i - 1];
+        }
+        auto S = [&heaviest](VertexId u, unsigned int c)
+        { return heaviest[u][std::min<long unsigned int>(c, heaviest[u].size() - 1)]; };
+
+        // Remove the vertices whose cliques are all lighter than the lower bound
+        std::vector<VertexId> removed;
+        std::vector<long unsigned int> neighbor_sums;
+        for (auto v : _vertices)
+        {
+            unsigned int c = cores[v];
+            neighbor_sums.clear();
+            for (const auto &[u, e] : neighbors(v))
+                if (u != v)
+                    neighbor_sums.push_back(S(u, c));
+            long unsigned int k = std::min<long unsigned int>(c, neighbor_sums.size());
+            std::nth_element(neighbor_sums.begin(), neighbor_sums.begin() + k, neighbor_sums.end(),
+                             std::greater<long unsigned int>());
+
+            long unsigned int bound = S(v, c);
+            for (long unsigned int i = 0; i < k; i++)
+                bound += neighbor_sums[i];
+            if (bound < 2 * lower_bound)
+                removed.push_back(v);
+        }
+        // Keep a vertex if they would all be removed, since a single vertex is
+        // a clique of weight 0
+        if (removed.size() == size())
+            removed.pop_back();
+        for (auto v : removed)
+            removeVertex(v);
+        changed |= !removed.empty();
+
+        // Remove the light edges that are in no triangle
+        std::vector<std::pair<VertexId, VertexId>> light;
+        for (const auto &edge : _edges)
+        {
+            VertexId a = edge.firstId(), b = edge.secondId();
+            if (edge.weight() >= lower_bound || a == b)
+                continue;
+            if (degree(a) > degree(b))
+                std::swap(a, b);
+            const auto &larger = neighbors(b);
+            if (std::none_of(neighbors(a).begin(), neighbors(a).end(), [&](const auto &neighbor)
+                             { return neighbor.first != a && neighbor.first != b && larger.count(neighbor.first); }))
+                light.emplace_back(a, b);
+        }
+        for (const auto &[a, b] : light)
+            removeEdge(a, b);
+        changed |= !light.empty();
+
+        // Remove the isolated vertices as long as there is an edge
+        if (!_edges.empty())
+        {
+            removed.clear();
+            for (auto v : _vertices)
+                if (degree(v) == 0)
+                    removed.push_back(v);
+            for (auto v : removed)
+                removeVertex(v);
+            changed |= !removed.empty();
+        }
+    }
+
+    report.vertices = initial_vertices - size();
+    report.edges = initial_edges - _edges.size();
+    return report;
+}
+
+/**
+ * @brief Erase an edge from the adjacency matrix and the edge arena
+ *
+ * The arena is kept contiguous by moving its last edge into the hole, so the
+ * edge that had the highest id gets the id of the erased one.
+ *
+ * @param e The id of the edge to erase
+ */
+void Graph::eraseEdge(EdgeId e) // Time complexity: O(1)
+{
+    const Edge &edge = _edges[e];
+    _adjacencyMatrix[edge.firstId()].erase(edge.secondId());
+    _adjacencyMatrix[edge.secondId()].erase(edge.firstId());
+    updateDegrees(edge.firstId(), edge.secondId(), -1, -static_cast<long int>(edge.weight()));
+
+    EdgeId last = _edges.size() - 1;
+    if (e != last)
+    {
+        _edges[e] = _edges[last];
+        const Edge &moved = _edges[e];
+        _adjacencyMatrix[moved.firstId()][moved.secondId()] = e;
+        _adjacencyMatrix[moved.secondId()][moved.firstId()] = e;
+    }
+    _edges.pop_back();
+}
+
+/**
+ * @brief Update the degrees of the two vertices of an edge
+ *
+ * The degree arrays grow up to the ids of the vertices, and the cached sorted
+ * orders are invalidated. A loop only counts once for its vertex, like in the
+ * adjacency matrix.
+ *
+ * @param first_id The id of the first vertex of the edge
+ * @param second_id The id of the second vertex of the edge
+ * @param degree The change of degree (1 for an added edge, -1 for a removed one)
+ * @param weight The change of weighted degree
+ */
+void Graph::updateDegrees(VertexId first_id, VertexId second_id, long int degree, long int weight) // Time complexity: O(1) amortized
+{
+    long unsigned int size = std::max(first_id, second_id) + 1;
+    if (size > _degrees.size())
+    {
+        _degrees.resize(size, 0);
+        _weightedDegrees.resize(size, 0);
+    }
+
+    _degrees[first_id] += degree;
+    _weightedDegrees[first_id] += weight;
+    if (second_id != first_id)
+    {
+        _degrees[second_id] += degree;
+        _weightedDegrees[second_id] += weight;
+    }
+
+    _byDegreeValid = false;
+    _byWeightedDegreeValid = false;
 }
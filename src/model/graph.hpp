@@ -9,8 +9,9 @@
 #include <memory>
 #include <optional>
 #include <unordered_map>
-#include <unordered_set>
+#include <vector>
 
+#include "bit_adjacency.hpp"
 #include "vertex.hpp"
 #include "edge.hpp"
 
@@ -19,12 +20,39 @@
 
 #define GraphPtr std::shared_ptr<Graph>
 
+// Position of an absent vertex in the vertex directory of a Graph
+#define NO_VERTEX UINT32_MAX
+
+/**
+ * @brief What a kernelization removed from a graph
+ */
+struct KernelReport
+{
+    long unsigned int vertices = 0; // removed vertices
+    long unsigned int edges = 0;    // removed edges, with those of the removed vertices
+    unsigned int rounds = 0;        // rounds of reductions until none applied
+};
+
 /**
  * @brief The Graph class
  *
- * This class represents a graph. It contains a set of vertices and a set
- * of edges. It also contains a map of vertices and a map of edges for faster
- * lookup.
+ * This class represents a graph. It contains the list of its vertices and the
+ * edges of the graph stored contiguously in an arena, where an edge is
+ * identified by its position (EdgeId). It also contains an adjacency matrix
+ * mapping the ids of two adjacent vertices to their edge for faster lookup.
+ *
+ * The vertices are found by id through a directory indexed by id, which holds
+ * the position of each vertex in the list, and a bitmap of the ids in use.
+ * The bitmap has the layout of a BitAdjacency bitset, so it can be combined
+ * with the rows of bitAdjacency() using the BitAdjacency static methods.
+ *
+ * The degree and the weighted degree (sum of the weights of the incident
+ * edges) of every vertex are kept up to date when edges are added or removed,
+ * and the vertices sorted by these criteria are computed on demand and cached
+ * until the graph is modified.
+ *
+ * The methods working with EdgePtr are kept for compatibility, they copy the
+ * edges out of the arena.
  */
 class Graph
 {
@@ -33,31 +61,57 @@ public:
     ~Graph();
 
     // Set methods
-    inline void addVertex(const VertexPtr &v) { _vertices.insert(v); }
-    inline void addEdge(const EdgePtr &e)
-    {
-        _edges.insert(e);
-        // Considering simple undirected graphs (no parallel edges and no self-loops)
-        // we need to add the edge to the adjacency matrix in both directions
-        _adjacencyMatrix[e->first()->id()][e->second()->id()] = e;
-        _adjacencyMatrix[e->second()->id()][e->first()->id()] = e;
-    }
+    void addVertex(VertexId id);
+    inline void addVertex(const VertexPtr &v) { addVertex(v->id()); }
+    EdgeId addEdge(VertexId first_id, VertexId second_id, unsigned int weight);
+    inline EdgeId addEdge(const Edge &e) { return addEdge(e.firstId(), e.secondId(), e.weight()); }
+    inline EdgeId addEdge(const EdgePtr &e) { return addEdge(*e); }
 
     // Get methods
-    const std::optional<VertexPtr> getVertex(unsigned int id) const;
     const std::optional<EdgePtr> getEdge(unsigned int first_id, unsigned int second_id) const;
     const std::optional<EdgePtr> getEdge(const VertexPtr &first, const VertexPtr &second) const;
+    const std::optional<EdgeId> findEdge(VertexId first_id, VertexId second_id) const;
+    inline const Edge &edge(EdgeId e) const { return _edges[e]; }
+    unsigned int weight(unsigned int first_id, unsigned int second_id) const;
+    unsigned int weight(const VertexPtr &first, const VertexPtr &second) const;
 
-    inline const std::unordered_set<VertexPtr> vertices() const { return _vertices; };
-    inline const std::unordered_set<EdgePtr> edges() const { return _edges; };
-    inline const std::unordered_map<unsigned int, std::unordered_map<unsigned int, EdgePtr>>
+    inline const std::vector<VertexId> &vertices() const { return _vertices; };
+    inline const std::vector<uint64_t> &vertexSet() const { return _present; };
+    inline unsigned int idBound() const { return _directory.size(); }
+    long unsigned int countVertices(unsigned int first_id, unsigned int last_id) const;
+    inline const std::vector<Edge> &edges() const { return _edges; };
+    inline const std::unordered_map<VertexId, std::unordered_map<VertexId, EdgeId>> &
     adjacencyMatrix() const { return _adjacencyMatrix; };
 
+    const std::unordered_map<VertexId, EdgeId> &neighbors(unsigned int id) const;
+    inline const std::unordered_map<VertexId, EdgeId> &neighbors(const VertexPtr &v) const { return neighbors(v->id()); }
+    inline long unsigned int degree(unsigned int id) const { return id < _degrees.size() ? _degrees[id] : 0; }
+    inline long unsigned int degree(const VertexPtr &v) const { return degree(v->id()); }
+    inline long unsigned int weightedDegree(unsigned int id) const
+    {
+        return id < _weightedDegrees.size() ? _weightedDegrees[id] : 0;
+    }
+    inline long unsigned int weightedDegree(const VertexPtr &v) const { return weightedDegree(v->id()); }
+
+    const std::vector<VertexId> &verticesByDegree() const;
+    const std::vector<VertexId> &verticesByWeightedDegree() const;
+    std::vector<unsigned int> coreNumbers() const;
+
     inline long unsigned int size() const { return _vertices.size(); }
 
+    BitAdjacency bitAdjacency() const;
+
     // Boolean methods
-    bool hasVertex(unsigned int id) const;
-    bool hasVertex(const VertexPtr &v) const;
+    inline bool hasVertex(unsigned int id) const
+    {
+        return id < _directory.size() && BitAdjacency::test(_present.data(), id);
+    }
+    inline bool hasVertex(const VertexPtr &v) const { return hasVertex(v->id()); }
+    bool hasVertices(const std::vector<VertexId> &ids) const;
+    inline bool hasVertices(unsigned int first_id, unsigned int last_id) const
+    {
+        return countVertices(first_id, last_id) == last_id - first_id;
+    }
     bool hasEdge(unsigned int first_id, unsigned int second_id) const;
     bool hasEdge(const VertexPtr &first, const VertexPtr &second) const;
     bool hasEdge(const EdgePtr &e) const;
@@ -65,17 +119,31 @@ public:
     inline bool empty() const { return _vertices.empty(); }
 
     // Remove methods
-    const std::optional<VertexPtr> removeVertex(unsigned int id);
-    const std::optional<VertexPtr> removeVertex(const VertexPtr &v);
+    const std::optional<VertexId> removeVertex(unsigned int id);
+    const std::optional<VertexId> removeVertex(const VertexPtr &v);
     const std::optional<EdgePtr> removeEdge(unsigned int first_id, unsigned int second_id);
     const std::optional<EdgePtr> removeEdge(const VertexPtr &first, const VertexPtr &second);
     const std::optional<EdgePtr> removeEdge(const EdgePtr &e);
 
+    KernelReport kernelize(long unsigned int lower_bound);
+
 protected:
-    std::unordered_map<unsigned int, std::unordered_map<unsigned int, EdgePtr>>
+    void eraseEdge(EdgeId e);
+    void updateDegrees(VertexId first_id, VertexId second_id, long int degree, long int weight);
+
+    std::unordered_map<VertexId, std::unordered_map<VertexId, EdgeId>>
         _adjacencyMatrix;
-    std::unordered_set<VertexPtr> _vertices;
-    std::unordered_set<EdgePtr> _edges;
+    std::vector<VertexId> _vertices;      // ids of the vertices of the graph, in no particular order
+    std::vector<unsigned int> _directory; // id -> position in _vertices (or NO_VERTEX)
+    std::vector<uint64_t> _present;       // bitmap of the ids in use
+
+    std::vector<unsigned int> _degrees;              // id -> number of incident edges
+    std::vector<long unsigned int> _weightedDegrees; // id -> sum of the weights of the incident edges
+    mutable std::vector<VertexId> _byDegree;         // cached verticesByDegree()
+    mutable std::vector<VertexId> _byWeightedDegree; // cached verticesByWeightedDegree()
+    mutable bool _byDegreeValid = false;
+    mutable bool _byWeightedDegreeValid = false;
+    std::vector<Edge> _edges; // edge arena, indexed by EdgeId
 };
 
-#endif // GRAPH_HPP
\ No newline at end of file
+#endif // GRAPH_HPP
@@ -0,0 +1,161 @@
+/**
+ * @file indexed_heap.hpp
+ * @brief Declaration and implementation of the IndexedMaxHeap class
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <utility>
+#include <vector>
+
+#ifndef INDEXED_HEAP_HPP
+#define INDEXED_HEAP_HPP
+
+/**
+ * @brief The IndexedMaxHeap class
+ *
+ * This class is a binary max-heap of items numbered from 0 to capacity - 1
+ * (the dense indices of a FrozenGraph, for instance), each one with a key. The
+ * position of each item in the heap is kept up to date, so that the key of any
+ * item can be increased and any item can be removed in O(log n), not only the
+ * top one.
+ *
+ * Items with equal keys are ordered by increasing index, so the order in which
+ * the items come out doesn't depend on the order in which they were pushed.
+ *
+ * Everything is allocated by the constructor: the operations don't allocate.
+ */
+template <typename Key>
+class IndexedMaxHeap
+{
+public:
+    IndexedMaxHeap(unsigned int capacity) : _keys(capacity), _positions(capacity, capacity)
+    {
+        _heap.reserve(capacity);
+    }
+    ~IndexedMaxHeap() {}
+
+    // Get methods
+    inline unsigned int size() const { return _heap.size(); }
+    inline unsigned int top() const { return _heap.front(); }
+    inline const Key &key(unsigned int item) const { return _keys[item]; }
+
+    // Items of the heap, in no particular order
+    inline const std::vector<unsigned int> &items() const { return _heap; }
+
+    // Boolean methods
+    inline bool empty() const { return _heap.empty(); }
+    inline bool contains(unsigned int item) const { return _positions[item] != _positions.size(); }
+
+    /**
+     * @brief Add an item to the heap
+     *
+     * @param item The item, which must not be in the heap
+     * @param key The key of the item
+     */
+    void push(unsigned int item, const Key &key) // O(log n)
+    {
+        _keys[item] = key;
+        _positions[item] = _heap.size();
+        _heap.push_back(item);
+        up(_heap.size() - 1);
+    }
+
+    /**
+     * @brief Remove the item with the highest key
+     */
+    void pop() // O(log n)
+    {
+        remove(_heap.front());
+    }
+
+    /**
+     * @brief Increase the key of an item
+     *
+     * @param item The item, which must be in the heap
+     * @param key The new key of the item, not lower than the current one
+     */
+    void increase(unsigned int item, const Key &key) // O(log n)
+    {
+        _keys[item] = key;
+        up(_positions[item]);
+    }
+
+    /**
+     * @brief Remove an item from the heap
+     *
+     * @param item The item, which must be in the heap
+     */
+    void remove(unsigned int item) // O(log n)
+    {
+        unsigned int position = _positions[item];
+        _positions[item] = _positions.size();
+
+        // Fill the hole with the last item and move it where it belongs
+        unsigned int last = _heap.back();
+        _heap.pop_back();
+        if (last == item)
+            return;
+        _heap[position] = last;
+        _positions[last] = position;
+        up(position);
+        down(_positions[last]);
+    }
+
+    /**
+     * @brief Remove all the items
+     */
+    void clear() // O(n)
+    {
+        for (auto item : _heap)
+            _positions[item] = _positions.size();
+        _heap.clear();
+    }
+
+private:
+    // Whether the item a comes out before the item b
+    inline bool before(unsigned int a, unsigned int b) const
+    {
+        return _keys[b] < _keys[a] || (!(_keys[a] < _keys[b]) && a < b);
+    }
+
+    inline void swap(unsigned int i, unsigned int j)
+    {
+        std::swap(_heap[i], _heap[j]);
+        _positions[_heap[i]] = i;
+        _positions[_heap[j]] = j;
+    }
+
+    // Move the item at a position up while it comes out before its parent
+    void up(unsigned int position)
+    {
+        while (position > 0 && before(_heap[position], _heap[(position - 1) / 2]))
+        {
+            swap(position, (position - 1) / 2);
+            position = (position - 1) / 2;
+        }
+    }
+
+    // Move the item at a position down while a child comes out before it
+    void down(unsigned int position)
+    {
+        while (true)
+        {
+            unsigned int best = position;
+            for (unsigned int child = 2 * position + 1; child <= 2 * position + 2 && child < _heap.size(); child++)
+                if (before(_heap[child], _heap[best]))
+                    best = child;
+            if (best == position)
+                return;
+            swap(position, best);
+            position = best;
+        }
+    }
+
+    std::vector<Key> _keys;               // item -> key
+    std::vector<unsigned int> _positions; // item -> position in _heap (or capacity if absent)
+    std::vector<unsigned int> _heap;      // binary heap of the items
+};
+
+#endif // INDEXED_HEAP_HPP
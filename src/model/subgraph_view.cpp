@@ -0,0 +1,188 @@
+/**
+ * @file subgraph_view.cpp
+ * @brief Implementation of the SubgraphView class
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <algorithm>
+
+#include "subgraph_view.hpp"
+
+/**
+ * @brief Construct a new SubgraphView:: SubgraphView object
+ *
+ * The view is created with all the vertices of the graph.
+ *
+ * @param graph The frozen graph to view
+ */
+SubgraphView::SubgraphView(const FrozenGraph &graph)
+    : _graph(&graph),
+      _included((graph.size() + WORD_BITS - 1) / WORD_BITS, ~uint64_t(0)),
+      _size(graph.size())
+{
+    if (graph.size() % WORD_BITS)
+        _included.back() = (uint64_t(1) << (graph.size() % WORD_BITS)) - 1;
+}
+
+/**
+ * @brief Destroy the SubgraphView:: SubgraphView object
+ */
+SubgraphView::~SubgraphView()
+{
+}
+
+/* SET METHODS */
+
+/**
+ * @brief Exclude a vertex from the view
+ *
+ * @param v The index of the vertex
+ */
+void SubgraphView::exclude(unsigned int v) // Time complexity: O(1)
+{
+    if (!hasVertex(v))
+        return;
+    BitAdjacency::reset(_included.data(), v);
+    _size--;
+}
+
+/**
+ * @brief Include a vertex of the graph back in the view
+ *
+ * @param v The index of the vertex
+ */
+void SubgraphView::include(unsigned int v) // Time complexity: O(1)
+{
+    if (hasVertex(v))
+        return;
+    BitAdjacency::set(_included.data(), v);
+    _size++;
+}
+
+/* GET METHODS */
+
+/**
+ * @brief Get the included vertices
+ *
+ * @return std::vector<unsigned int> The sorted indices of the included vertices
+ */
+std::vector<unsigned int> SubgraphView::vertices() const // Time complexity: O(n / 64 + k)
+{
+    std::vector<unsigned int> vertices;
+    vertices.reserve(_size);
+    for (unsigned int i = 0; i < words(); i++)
+        for (uint64_t word = _included[i]; word; word &= word - 1)
+            vertices.push_back(i * WORD_BITS + __builtin_ctzll(word));
+    return vertices;
+}
+
+/**
+ * @brief Get the included vertices in a degeneracy order
+ *
+ * The vertices are peeled by increasing degree (k-core decomposition of
+ * Batagelj and Zaversnik): each vertex has the smallest degree among the
+ * vertices after it, so that every vertex has at most d neighbors after it in
+ * the order, where d is the degeneracy of the view.
+ *
+ * The vertices are kept in buckets by current degree, a vertex being moved to
+ * the previous bucket by swapping it with the first vertex of its bucket.
+ *
+ * @return std::vector<unsigned int> The indices of the included vertices in a
+ * degeneracy order
+ */
+std::vector<unsigned int> SubgraphView::degeneracyOrder() const // Time complexity: O(n + m)
+{
+    std::vector<unsigned int> order = vertices();
+    std::vector<unsigned int> degrees(_graph->size(), 0);
+    unsigned int max_degree = 0;
+    for (auto v : order)
+    {
+        degrees[v] = degree(v);
+        max_degree = std::max(max_degree, degrees[v]);
+    }
+
+    // Sort the vertices by degree with a counting sort, bins[d] being the
+    // position of the first vertex of degree d
+    std::vector<unsigned int> bins(max_degree + 2, 0);
+    for (auto v : order)
+        bins[degrees[v] + 1]++;
+    for (unsigned int d = 1; d < bins.size(); d++)
+        bins[d] += bins[d - 1];
+    std::vector<unsigned int> positions(_graph->size(), 0);
+    for (auto v : std::vector<unsigned int>(order))
+    {
+        positions[v] = bins[degrees[v]]++;
+        order[positions[v]] = v;
+    }
+    for (unsigned int d = max_degree + 1; d > 0; d--)
+        bins[d] = bins[d - 1];
+    bins[0] = 0;
+
+    // Peel the vertex of smallest degree and decrement the degrees of its
+    // neighbors that are still in the view
+    for (unsigned int i = 0; i < order.size(); i++)
+    {
+        unsigned int v = order[i];
+        for (auto u : _graph->neighbors(v))
+        {
+            if (!hasVertex(u) || degrees[u] <= degrees[v])
+                continue;
+
+            // Swap u with the first vertex of its bin and shrink the bin
+            unsigned int first = order[bins[degrees[u]]];
+            if (first != u)
+            {
+                std::swap(order[positions[u]], order[bins[degrees[u]]]);
+                std::swap(positions[u], positions[first]);
+            }
+            bins[degrees[u]]++;
+            degrees[u]--;
+        }
+    }
+    return order;
+}
+
+/**
+ * @brief Get the degree of a vertex in the view
+ *
+ * Only the neighbors that are included in the view are counted.
+ *
+ * @param v The index of the vertex
+ * @return unsigned int The degree of the vertex
+ */
+unsigned int SubgraphView::degree(unsigned int v) const // Time complexity: O(d(v))
+{
+    if (full())
+        return _graph->degree(v);
+
+    unsigned int degree = 0;
+    for (auto u : _graph->neighbors(v))
+        degree += hasVertex(u);
+    return degree;
+}
+
+/**
+ * @brief Get the sum of the weights of the edges of a vertex in the view
+ *
+ * Only the edges to neighbors that are included in the view are counted. The
+ * weighted degree cached by the graph is used when the view is full.
+ *
+ * @param v The index of the vertex
+ * @return long unsigned int The weighted degree of the vertex
+ */
+long unsigned int SubgraphView::weightedDegree(unsigned int v) const // Time complexity: O(1) or O(d(v))
+{
+    if (full())
+        return _graph->weightedDegree(v);
+
+    auto neighbors = _graph->neighbors(v);
+    auto weights = _graph->weights(v);
+
+    long unsigned int sum = 0;
+    for (long unsigned int i = 0; i < neighbors.size(); i++)
+        if (hasVertex(neighbors[i]))
+            sum += weights[i];
+    return sum;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file subgraph_view.hpp
+ * @brief Declaration of the SubgraphView class
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "bit_adjacency.hpp"
+#include "frozen_graph.hpp"
+
+#ifndef SUBGRAPH_VIEW_HPP
+#define SUBGRAPH_VIEW_HPP
+
+/**
+ * @brief The SubgraphView class
+ *
+ * This class represents the subgraph of a FrozenGraph induced by a subset of
+ * its vertices, without copying the graph: it only holds a reference to the
+ * graph and a bitset of the included vertices (with the layout of a
+ * BitAdjacency bitset). Creating or copying a view is O(n / 64).
+ *
+ * The vertices keep their indices in the graph. The neighbors() and weights()
+ * of the graph still contain the excluded vertices, so the algorithms have to
+ * filter them with hasVertex() or by intersecting with vertexSet().
+ *
+ * The graph must outlive the view.
+ */
+class SubgraphView
+{
+public:
+    SubgraphView(const FrozenGraph &graph);
+    ~SubgraphView();
+
+    // Set methods
+    void exclude(unsigned int v);
+    void include(unsigned int v);
+
+    // Get methods
+    inline const FrozenGraph &graph() const { return *_graph; }
+    inline unsigned int size() const { return _size; }
+    inline unsigned int words() const { return _included.size(); }
+    inline const std::vector<uint64_t> &vertexSet() const { return _included; }
+    std::vector<unsigned int> vertices() const;
+    std::vector<unsigned int> degeneracyOrder() const;
+
+    unsigned int degree(unsigned int v) const;
+    long unsigned int weightedDegree(unsigned int v) const;
+
+    // Boolean methods
+    inline bool hasVertex(unsigned int v) const { return BitAdjacency::test(_included.data(), v); }
+    inline bool full() const { return _size == _graph->size(); }
+    inline bool empty() const { return _size == 0; }
+
+private:
+    const FrozenGraph *_graph;
+    std::vector<uint64_t> _included; // bitset of the included vertices
+    unsigned int _size;              // number of included vertices
+};
+
+#endif // SUBGRAPH_VIEW_HPP
@@ -0,0 +1,184 @@
+/**
+ * @file task_pool.hpp
+ * @brief Declaration and implementation of the TaskPool class
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#ifndef TASK_POOL_HPP
+#define TASK_POOL_HPP
+
+/**
+ * @brief The TaskPool class
+ *
+ * This class runs tasks on a fixed number of worker threads with work
+ * stealing. Each worker has its own deque of tasks: it pushes and pops the
+ * tasks at the back of its deque, and steals the tasks at the front of the
+ * deques of the other workers when its own is empty.
+ *
+ * A task may push new tasks while it runs, which is how a search tree is split
+ * between the workers. The tasks at the front of a deque are the oldest ones,
+ * that is the biggest subtrees, so a thief takes as much work as possible.
+ *
+ * A worker that finds no task anywhere sleeps on a condition variable until a
+ * task is pushed or the pool stops, instead of spinning.
+ *
+ * The pool stops once every task has been run and no task is running anymore.
+ */
+template <typename Task>
+class TaskPool
+{
+public:
+    TaskPool(unsigned int workers) : _queues(workers), _pending(0), _idle(0), _pushes(0) {}
+    ~TaskPool() {}
+
+    // Get methods
+    inline unsigned int workers() const { return _queues.size(); }
+
+    // Boolean methods
+
+    // Whether some worker is waiting for a task, in which case the running
+    // tasks should push their subtasks instead of running them
+    inline bool hungry() const { return _idle.load(std::memory_order_relaxed) > 0; }
+
+    /**
+     * @brief Push a task to the deque of a worker
+     *
+     * @param worker The worker pushing the task
+     * @param task The task to push
+     */
+    void push(unsigned int worker, Task task)
+    {
+        _pending.fetch_add(1);
+        {
+            std::lock_guard<std::mutex> lock(_queues[worker].mutex);
+            _queues[worker].tasks.push_back(std::move(task));
+        }
+        _pushes.fetch_add(1);
+        if (_idle.load() > 0)
+            wake(false);
+    }
+
+    /**
+     * @brief Run the tasks until there is none left
+     *
+     * The calling thread is the worker 0, the other workers are new threads.
+     *
+     * @param process The function running a task, given the worker running it
+     */
+    void run(const std::function<void(unsigned int, Task &)> &process)
+    {
+        std::vector<std::thread> threads;
+        for (unsigned int worker = 1; worker < workers(); worker++)
+            threads.emplace_back(&TaskPool::work, this, worker, std::cref(process));
+        work(0, process);
+        for (auto &thread : threads)
+            thread.join();
+    }
+
+private:
+    /**
+     * @brief Run the tasks of a worker and steal the tasks of the others
+     *
+     * @param worker The worker
+     * @param process The function running a task
+     */
+    void work(unsigned int worker, const std::function<void(unsigned int, Task &)> &process)
+    {
+        bool idle = false;
+        while (true)
+        {
+            // The pushes seen before looking for a task, a later one wakes the
+            // worker up if it finds none
+            long unsigned int pushes = _pushes.load();
+            std::optional<Task> task = pop(worker);
+            if (!task.has_value())
+                for (unsigned int i = 1; i < workers() && !task.has_value(); i++)
+                    task = steal((worker + i) % workers());
+
+            if (task.has_value())
+            {
+                if (idle)
+                    _idle.fetch_sub(1);
+                idle = false;
+
+                process(worker, task.value());
+                if (_pending.fetch_sub(1) == 1)
+                    wake(true);
+                continue;
+            }
+
+            // No task left anywhere and none running, so none will be pushed
+            if (_pending.load() == 0)
+                break;
+            if (!idle)
+                _idle.fetch_add(1);
+            idle = true;
+
+            std::unique_lock<std::mutex> lock(_mutex);
+            _wakeup.wait(lock, [this, pushes]
+                         { return _pushes.load() != pushes || _pending.load() == 0; });
+        }
+        if (idle)
+            _idle.fetch_sub(1);
+    }
+
+    // Wake up one sleeping worker for a new task, or all of them once the pool
+    // stops. The mutex is taken so that a worker can't miss the notification
+    // between checking its condition and going to sleep
+    void wake(bool all)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (all)
+            _wakeup.notify_all();
+        else
+            _wakeup.notify_one();
+    }
+
+    // Pop the newest task of a worker
+    std::optional<Task> pop(unsigned int worker)
+    {
+        std::lock_guard<std::mutex> lock(_queues[worker].mutex);
+        if (_queues[worker].tasks.empty())
+            return std::nullopt;
+        Task task = std::move(_queues[worker].tasks.back());
+        _queues[worker].tasks.pop_back();
+        return task;
+    }
+
+    // Steal the oldest task of a worker
+    std::optional<Task> steal(unsigned int worker)
+    {
+        std::lock_guard<std::mutex> lock(_queues[worker].mutex);
+        if (_queues[worker].tasks.empty())
+            return std::nullopt;
+        Task task = std::move(_queues[worker].tasks.front());
+        _queues[worker].tasks.pop_front();
+        return task;
+    }
+
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<Queue> _queues;         // worker -> deque of tasks
+    std::atomic<unsigned int> _pending; // tasks pushed and not finished yet
+    std::atomic<unsigned int> _idle;    // workers waiting for a task
+    std::atomic<long unsigned int> _pushes; // tasks pushed so far
+    std::mutex _mutex;                  // guards the sleep of the idle workers
+    std::condition_variable _wakeup;    // wakes up the idle workers
+};
+
+#endif // TASK_POOL_HPP
@@ -6,6 +6,7 @@
  * @date 2022-12-26
  */
 
+#include <cstdint>
 #include <memory>
 
 #ifndef VERTEX_HPP
@@ -13,6 +14,9 @@
 
 #define VertexPtr std::shared_ptr<Vertex>
 
+// Plain 32-bit handle of a vertex: its id
+typedef uint32_t VertexId;
+
 /**
  * @brief The Vertex class
  *
@@ -0,0 +1,45 @@
+/**
+ * @file weight_matrix.cpp
+ * @brief Implementation of the WeightMatrix class
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include "weight_matrix.hpp"
+
+/**
+ * @brief Construct a new WeightMatrix:: WeightMatrix object
+ *
+ * The matrix is created without any edge.
+ *
+ * @param size The number of vertices
+ */
+WeightMatrix::WeightMatrix(unsigned int size)
+    : _size(size),
+      _matrix(static_cast<long unsigned int>(size) * (size > 0 ? size - 1 : 0) / 2, 0)
+{
+}
+
+/**
+ * @brief Destroy the WeightMatrix:: WeightMatrix object
+ */
+WeightMatrix::~WeightMatrix()
+{
+}
+
+/**
+ * @brief Check if a packed weight matrix is worth it for a graph
+ *
+ * The matrix takes n^2 / 2 bytes. It is considered worth it when it takes less
+ * memory than the neighbor and weight arrays of a FrozenGraph (16 bytes per
+ * edge), that is for graphs with a density of at least 1/16.
+ *
+ * @param vertices The number of vertices of the graph
+ * @param edges The number of edges of the graph
+ * @return true If the weight matrix should be used, false otherwise
+ */
+bool WeightMatrix::fits(long unsigned int vertices, long unsigned int edges)
+{
+    return vertices * vertices / 2 <= 16 * edges;
+}
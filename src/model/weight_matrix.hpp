@@ -0,0 +1,70 @@
+/**
+ * @file weight_matrix.hpp
+ * @brief Declaration of the WeightMatrix class
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#ifndef WEIGHT_MATRIX_HPP
+#define WEIGHT_MATRIX_HPP
+
+// Highest edge weight that can be stored in a WeightMatrix
+#define MAX_PACKED_WEIGHT 255
+
+/**
+ * @brief The WeightMatrix class
+ *
+ * This class represents the edge weights of a graph as a packed upper
+ * triangular matrix of bytes, where 0 means that there is no edge. It can
+ * only hold weights from 1 to MAX_PACKED_WEIGHT, which covers the instances
+ * of the graph generator (weights from 1 to 100).
+ *
+ * Like the BitAdjacency, the vertices are numbered from 0 to size() - 1 by the
+ * producer of the matrix.
+ */
+class WeightMatrix
+{
+public:
+    WeightMatrix(unsigned int size = 0);
+    ~WeightMatrix();
+
+    // Set methods
+    inline void setWeight(unsigned int u, unsigned int v, uint8_t weight) { _matrix[position(u, v)] = weight; }
+
+    // Get methods
+    inline unsigned int size() const { return _size; }
+    inline uint8_t weight(unsigned int u, unsigned int v) const
+    {
+        return u == v ? 0 : _matrix[position(u, v)];
+    }
+
+    // Boolean methods
+    inline bool hasEdge(unsigned int u, unsigned int v) const { return weight(u, v) != 0; }
+
+    static bool fits(long unsigned int vertices, long unsigned int edges);
+
+private:
+    /**
+     * @brief Get the position of the weight of an edge in the packed matrix
+     *
+     * @param u The first vertex
+     * @param v The second vertex, different from the first one
+     * @return long unsigned int The position of the weight
+     */
+    inline long unsigned int position(long unsigned int u, long unsigned int v) const
+    {
+        if (u > v)
+            std::swap(u, v);
+        return u * (2 * _size - u - 1) / 2 + (v - u - 1);
+    }
+
+    unsigned int _size;
+    std::vector<uint8_t> _matrix;
+};
+
+#endif // WEIGHT_MATRIX_HPP
@@ -0,0 +1,78 @@
+/**
+ * @file test.hpp
+ * @brief Declaration of the test harness and of the helpers shared by the tests
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../src/model/frozen_graph.hpp"
+#include "../src/model/graph.hpp"
+
+#ifndef TEST_HPP
+#define TEST_HPP
+
+typedef void (*TestFunction)();
+
+/**
+ * @brief The error thrown by a failed check, which fails the running test
+ */
+class TestFailure : public std::runtime_error
+{
+public:
+    TestFailure(const std::string &message) : std::runtime_error(message) {}
+};
+
+int registerTest(const char *name, TestFunction test);
+void fail(const char *file, int line, const std::string &message);
+
+// Define a test, which is run by the test runner
+#define TEST(name)                                                                   \
+    static void name();                                                              \
+    [[maybe_unused]] static const int name##_registered = registerTest(#name, name); \
+    static void name()
+
+// Fail the running test if the condition is false
+#define CHECK(condition)                                       \
+    do                                                         \
+    {                                                          \
+        if (!(condition))                                      \
+            fail(__FILE__, __LINE__, "CHECK(" #condition ")"); \
+    } while (0)
+
+// Fail the running test if the statement doesn't throw the exception
+#define CHECK_THROWS(statement, exception)                                            \
+    do                                                                                \
+    {                                                                                 \
+        bool thrown = false;                                                          \
+        try                                                                           \
+        {                                                                             \
+            statement;                                                                \
+        }                                                                             \
+        catch (const exception &)                                                     \
+        {                                                                             \
+            thrown = true;                                                            \
+        }                                                                             \
+        if (!thrown)                                                                  \
+            fail(__FILE__, __LINE__, "CHECK_THROWS(" #statement ", " #exception ")"); \
+    } while (0)
+
+/**
+ * @brief A clique of a frozen graph found by brute force
+ */
+struct BruteForceClique
+{
+    std::vector<unsigned int> vertices; // sorted indices
+    long unsigned int weight;
+    bool maximal;
+};
+
+Graph randomGraph(unsigned int vertices, double density, unsigned int max_weight, std::mt19937 &random);
+std::vector<BruteForceClique> bruteForceCliques(const FrozenGraph &graph);
+
+#endif // TEST_HPP
@@ -0,0 +1,193 @@
+/**
+ * @file test_checkpoint.cpp
+ * @brief Tests of the checkpoints of the exact algorithm
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+#include "../src/algorithm/checkpoint.hpp"
+#include "../src/algorithm/mewc.hpp"
+#include "test.hpp"
+
+/**
+ * @brief Get a path in the temporary directory for the files of a test
+ *
+ * @param name The name of the file
+ * @return std::string The path
+ */
+static std::string temporaryPath(const std::string &name)
+{
+    return (std::filesystem::temp_directory_path() / ("mewc_test_" + name)).string();
+}
+
+/**
+ * @brief Read a whole file
+ *
+ * @param path The path of the file
+ * @return std::string The bytes of the file
+ */
+static std::string readBytes(const std::string &path)
+{
+    std::ifstream input(path, std::ios::in | std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+}
+
+/**
+ * @brief Write a whole file
+ *
+ * @param path The path of the file
+ * @param bytes The bytes of the file
+ */
+static void writeBytes(const std::string &path, const std::string &bytes)
+{
+    std::ofstream output(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    output.write(bytes.data(), bytes.size());
+}
+
+/**
+ * @brief Get a checkpoint with a value in every field
+ *
+ * @return Checkpoint The checkpoint
+ */
+static Checkpoint sampleCheckpoint()
+{
+    Checkpoint checkpoint;
+    checkpoint.vertices = 70;
+    checkpoint.edges = 1234;
+    checkpoint.fingerprint = 0x0123456789abcdef;
+    checkpoint.pivot = Pivot::First;
+    checkpoint.engine = Engine::BitParallel;
+    checkpoint.next = 17;
+    checkpoint.nodes = 987654321;
+    checkpoint.clique = {3, 8, 42};
+    checkpoint.weight = 77;
+    checkpoint.words = 2;
+    checkpoint.R = {8, 42};
+    for (unsigned int i = 0; i < 3 * checkpoint.R.size() * checkpoint.words; i++)
+        checkpoint.sets.push_back(0x8000000000000001ul >> i);
+    checkpoint.weights = {0, 12};
+    return checkpoint;
+}
+
+TEST(checkpointRoundTrip)
+{
+    std::string path = temporaryPath("round_trip.bin");
+    Checkpoint saved = sampleCheckpoint();
+    saved.save(path);
+    Checkpoint loaded = Checkpoint::load(path);
+    std::filesystem::remove(path);
+
+    CHECK(loaded.vertices == saved.vertices);
+    CHECK(loaded.edges == saved.edges);
+    CHECK(loaded.fingerprint == saved.fingerprint);
+    CHECK(loaded.pivot == saved.pivot);
+    CHECK(loaded.engine == saved.engine);
+    CHECK(loaded.next == saved.next);
+    CHECK(loaded.nodes == saved.nodes);
+    CHECK(loaded.clique == saved.clique);
+    CHECK(loaded.weight == saved.weight);
+    CHECK(loaded.words == saved.words);
+    CHECK(loaded.R == saved.R);
+    CHECK(loaded.sets == saved.sets);
+    CHECK(loaded.weights == saved.weights);
+}
+
+TEST(checkpointRejectsTruncatedFiles)
+{
+    std::string path = temporaryPath("truncated.bin");
+    sampleCheckpoint().save(path);
+    std::string bytes = readBytes(path);
+    CHECK(!bytes.empty());
+
+    for (long unsigned int size = 0; size < bytes.size(); size++)
+    {
+        writeBytes(path, bytes.substr(0, size));
+        CHECK_THROWS(Checkpoint::load(path), std::runtime_error);
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(checkpointRejectsForeignFiles)
+{
+    std::string path = temporaryPath("foreign.bin");
+    writeBytes(path, "10 45\n1 2 3\n1 3 4\n");
+    CHECK_THROWS(Checkpoint::load(path), std::runtime_error);
+
+    // A checkpoint whose stack doesn't match the size of R
+    Checkpoint checkpoint = sampleCheckpoint();
+    checkpoint.weights.push_back(0);
+    checkpoint.save(path);
+    CHECK_THROWS(Checkpoint::load(path), std::runtime_error);
+
+    std::filesystem::remove(path);
+    CHECK_THROWS(Checkpoint::load(path), std::runtime_error);
+}
+
+TEST(checkpointFingerprintDependsOnTheWeights)
+{
+    std::mt19937 random(7);
+    Graph graph = randomGraph(20, 0.5, 10, random);
+    FrozenGraph frozen(graph);
+    CHECK(Checkpoint::fingerprintOf(SubgraphView(frozen)) == Checkpoint::fingerprintOf(SubgraphView(FrozenGraph(graph))));
+
+    const Edge &edge = graph.edges().front();
+    VertexId first = edge.firstId(), second = edge.secondId();
+    unsigned int weight = edge.weight();
+    graph.removeEdge(first, second);
+    graph.addEdge(first, second, weight + 1);
+    FrozenGraph changed(graph);
+    CHECK(Checkpoint::fingerprintOf(SubgraphView(frozen)) != Checkpoint::fingerprintOf(SubgraphView(changed)));
+}
+
+TEST(checkpointResumesOnlyItsOwnSearch)
+{
+    std::mt19937 random(11);
+    FrozenGraph graph(randomGraph(40, 0.4, 20, random));
+    std::string path = temporaryPath("resume.bin");
+
+    MEWCOptions options;
+    options.checkpoint = path;
+    Clique clique = exactMEWC(graph, options);
+    long unsigned int weight = graph.weight(graph.indices(clique));
+
+    // The final checkpoint holds the optimum
+    MEWCOptions resume;
+    resume.resume = path;
+    Clique resumed = exactMEWC(graph, resume);
+    CHECK(graph.weight(graph.indices(resumed)) == weight);
+
+    // Another graph of the same size
+    FrozenGraph other(randomGraph(40, 0.4, 20, random));
+    CHECK_THROWS(exactMEWC(other, resume), std::runtime_error);
+
+    // Vertices out of the graph
+    Checkpoint checkpoint = Checkpoint::load(path);
+    checkpoint.clique.push_back(graph.size());
+    checkpoint.save(path);
+    CHECK_THROWS(exactMEWC(graph, resume), std::runtime_error);
+
+    checkpoint = Checkpoint::load(path);
+    checkpoint.clique.pop_back();
+    checkpoint.next = 0;
+    checkpoint.R = {graph.size() + 5};
+    checkpoint.sets.assign(3 * checkpoint.words, 0);
+    checkpoint.weights = {0};
+    checkpoint.save(path);
+    CHECK_THROWS(exactMEWC(graph, resume), std::runtime_error);
+
+    // A clique whose weight is not the saved one
+    checkpoint = Checkpoint::load(path);
+    checkpoint.R.clear();
+    checkpoint.sets.clear();
+    checkpoint.weights.clear();
+    checkpoint.weight++;
+    checkpoint.save(path);
+    CHECK_THROWS(exactMEWC(graph, resume), std::runtime_error);
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,74 @@
+/**
+ * @file test_color_bound.cpp
+ * @brief Tests of the coloring bound of the branch and bound algorithm
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <algorithm>
+
+#include "../src/algorithm/exact_bnb_mewc.hpp"
+#include "test.hpp"
+
+TEST(colorBoundIsAnUpperBoundOfEveryPrefix)
+{
+    std::mt19937 random(3);
+    std::uniform_int_distribution<unsigned int> gain(0, 20);
+    for (unsigned int round = 0; round < 200; round++)
+    {
+        unsigned int n = 1 + round % 12;
+        FrozenGraph graph(randomGraph(n, (round % 5 + 1) / 6.0, 1 + round % 30, random));
+
+        std::vector<BnBCandidate> P;
+        for (unsigned int v = 0; v < n; v++)
+            P.push_back({v, gain(random)});
+        std::shuffle(P.begin(), P.end(), random);
+        std::vector<long unsigned int> gains(n);
+        for (const auto &candidate : P)
+            gains[candidate.vertex] = candidate.gain;
+
+        std::vector<long unsigned int> bounds;
+        colorBound(graph, P, bounds);
+
+        // The candidates are reordered, not changed
+        CHECK(P.size() == n);
+        CHECK(bounds.size() == n);
+        std::vector<bool> seen(n, false);
+        for (const auto &candidate : P)
+        {
+            CHECK(!seen[candidate.vertex]);
+            CHECK(candidate.gain == gains[candidate.vertex]);
+            seen[candidate.vertex] = true;
+        }
+        CHECK(std::is_sorted(bounds.begin(), bounds.end()));
+
+        // No clique made of the first i + 1 candidates adds more than bounds[i]
+        std::vector<unsigned int> position(n);
+        for (unsigned int i = 0; i < n; i++)
+            position[P[i].vertex] = i;
+        for (const auto &clique : bruteForceCliques(graph))
+        {
+            long unsigned int added = clique.weight;
+            unsigned int last = 0;
+            for (auto v : clique.vertices)
+            {
+                added += gains[v];
+                last = std::max(last, position[v]);
+            }
+            CHECK(added <= bounds[last]);
+        }
+    }
+}
+
+TEST(colorBoundOfAnIndependentSetIsTheHighestGain)
+{
+    std::mt19937 random(5);
+    FrozenGraph graph(randomGraph(6, 0, 1, random));
+    std::vector<BnBCandidate> P{{0, 4}, {1, 9}, {2, 1}, {3, 7}, {4, 0}, {5, 3}};
+    std::vector<long unsigned int> bounds;
+    colorBound(graph, P, bounds);
+
+    // A single color class, so the bound of a prefix is its highest gain
+    CHECK((bounds == std::vector<long unsigned int>{4, 9, 9, 9, 9, 9}));
+}
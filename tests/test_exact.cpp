@@ -0,0 +1,88 @@
+/**
+ * @file test_exact.cpp
+ * @brief Tests of the exact algorithms against brute force
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
+#include "../src/algorithm/mewc.hpp"
+#include "test.hpp"
+
+TEST(exactAlgorithmsFindTheOptimum)
+{
+    std::mt19937 random(29);
+    for (unsigned int round = 0; round < 60; round++)
+    {
+        unsigned int n = 1 + round % 16;
+        Graph graph = randomGraph(n, (round % 5 + 1) / 6.0, 1 + round % 40, random);
+        FrozenGraph frozen(graph);
+
+        long unsigned int optimum = 0;
+        for (const auto &clique : bruteForceCliques(frozen))
+            optimum = std::max(optimum, clique.weight);
+
+        for (Engine engine : {Engine::Sparse, Engine::BitParallel})
+            for (unsigned int threads : {1u, 3u})
+            {
+                MEWCOptions options;
+                options.engine = engine;
+                options.threads = threads;
+                Clique clique = exactMEWC(frozen, options);
+                CHECK(frozen.weight(frozen.indices(clique)) == optimum);
+                clique = exactBnBMEWC(frozen, options);
+                CHECK(frozen.weight(frozen.indices(clique)) == optimum);
+                clique = componentsMEWC(frozen, Algorithm::Exact, options);
+                CHECK(frozen.weight(frozen.indices(clique)) == optimum);
+            }
+
+        Clique clique = exactMEWC(graph);
+        CHECK(clique.weight(graph) == optimum);
+    }
+}
+
+TEST(enumerationVisitsEveryMaximalCliqueOnce)
+{
+    std::mt19937 random(31);
+    for (unsigned int round = 0; round < 60; round++)
+    {
+        unsigned int n = 1 + round % 16;
+        FrozenGraph graph(randomGraph(n, (round % 5 + 1) / 6.0, 5, random));
+
+        std::vector<std::vector<unsigned int>> expected;
+        for (const auto &clique : bruteForceCliques(graph))
+            if (clique.maximal)
+                expected.push_back(clique.vertices);
+        std::sort(expected.begin(), expected.end());
+
+        for (Engine engine : {Engine::Sparse, Engine::BitParallel})
+            for (unsigned int threads : {1u, 4u})
+            {
+                MEWCOptions options;
+                options.engine = engine;
+                options.threads = threads;
+                // The visitor may run on the workers, so the checks are done
+                // once the enumeration is over
+                std::vector<std::vector<unsigned int>> visited;
+                std::vector<std::pair<long unsigned int, long unsigned int>> weights;
+                std::mutex mutex;
+                enumerateMaximalCliques(
+                    SubgraphView(graph), [&](const std::vector<unsigned int> &clique, long unsigned int weight)
+                    {
+                        std::vector<unsigned int> sorted = clique;
+                        std::sort(sorted.begin(), sorted.end());
+                        std::lock_guard<std::mutex> lock(mutex);
+                        visited.push_back(sorted);
+                        weights.emplace_back(graph.weight(sorted), weight); },
+                    options);
+                std::sort(visited.begin(), visited.end());
+                CHECK(visited == expected);
+                for (const auto &[actual, given] : weights)
+                    CHECK(actual == given);
+            }
+    }
+}
@@ -0,0 +1,144 @@
+/**
+ * @file test_indexed_heap.cpp
+ * @brief Tests of the IndexedMaxHeap class
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <map>
+#include <set>
+#include <utility>
+
+#include "../src/model/indexed_heap.hpp"
+#include "test.hpp"
+
+TEST(indexedHeapPopsByDecreasingKeyThenIncreasingItem)
+{
+    IndexedMaxHeap<unsigned int> heap(6);
+    heap.push(4, 2);
+    heap.push(1, 5);
+    heap.push(3, 2);
+    heap.push(0, 7);
+    heap.push(5, 5);
+    CHECK(heap.size() == 5);
+    CHECK(!heap.contains(2));
+
+    std::vector<unsigned int> popped;
+    while (!heap.empty())
+    {
+        popped.push_back(heap.top());
+        heap.pop();
+    }
+    CHECK((popped == std::vector<unsigned int>{0, 1, 5, 3, 4}));
+    CHECK(!heap.contains(0));
+}
+
+TEST(indexedHeapIncreaseAndRemove)
+{
+    IndexedMaxHeap<unsigned int> heap(4);
+    for (unsigned int item = 0; item < 4; item++)
+        heap.push(item, item);
+    CHECK(heap.top() == 3);
+
+    heap.increase(1, 10);
+    CHECK(heap.top() == 1);
+    CHECK(heap.key(1) == 10);
+
+    heap.remove(1);
+    CHECK(!heap.contains(1));
+    CHECK(heap.top() == 3);
+
+    // Removing the last item of the array must not move anything
+    heap.remove(heap.items().back());
+    CHECK(heap.size() == 2);
+
+    heap.clear();
+    CHECK(heap.empty());
+    for (unsigned int item = 0; item < 4; item++)
+        CHECK(!heap.contains(item));
+    heap.push(2, 1);
+    CHECK(heap.top() == 2);
+}
+
+TEST(indexedHeapMatchesOrderedSet)
+{
+    const unsigned int capacity = 50;
+    std::mt19937 random(12);
+    IndexedMaxHeap<std::pair<unsigned int, unsigned int>> heap(capacity);
+
+    // The same items ordered like the heap: highest key first, then lowest item
+    std::set<std::pair<std::pair<unsigned int, unsigned int>, unsigned int>,
+             bool (*)(const std::pair<std::pair<unsigned int, unsigned int>, unsigned int> &,
+                      const std::pair<std::pair<unsigned int, unsigned int>, unsigned int> &)>
+        expected([](const auto &a, const auto &b)
+                 { return a.first != b.first ? b.first < a.first : a.second < b.second; });
+    std::map<unsigned int, std::pair<unsigned int, unsigned int>> keys;
+
+    std::uniform_int_distribution<unsigned int> item(0, capacity - 1), key(0, 5), operation(0, 9);
+    for (unsigned int step = 0; step < 20000; step++)
+    {
+        unsigned int i = item(random);
+        switch (operation(random))
+        {
+        case 0:
+        case 1:
+        case 2:
+        case 3:
+            if (!heap.contains(i))
+            {
+                std::pair<unsigned int, unsigned int> k{key(random), key(random)};
+                heap.push(i, k);
+                expected.insert({k, i});
+                keys[i] = k;
+            }
+            break;
+        case 4:
+        case 5:
+            if (heap.contains(i))
+            {
+                std::pair<unsigned int, unsigned int> k{keys[i].first + key(random), key(random)};
+                if (k < keys[i])
+                    k = keys[i];
+                heap.increase(i, k);
+                expected.erase({keys[i], i});
+                expected.insert({k, i});
+                keys[i] = k;
+            }
+            break;
+        case 6:
+        case 7:
+            if (heap.contains(i))
+            {
+                heap.remove(i);
+                expected.erase({keys[i], i});
+                keys.erase(i);
+            }
+            break;
+        case 8:
+            if (!heap.empty())
+            {
+                CHECK(heap.top() == expected.begin()->second);
+                keys.erase(heap.top());
+                heap.pop();
+                expected.erase(expected.begin());
+            }
+            break;
+        default:
+            if (step % 1000 == 999)
+            {
+                heap.clear();
+                expected.clear();
+                keys.clear();
+            }
+        }
+
+        CHECK(heap.size() == expected.size());
+        if (!heap.empty())
+        {
+            CHECK(heap.top() == expected.begin()->second);
+            CHECK(heap.key(heap.top()) == expected.begin()->first);
+        }
+        CHECK(heap.contains(i) == (keys.count(i) == 1));
+    }
+}
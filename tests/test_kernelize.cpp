@@ -0,0 +1,73 @@
+/**
+ * @file test_kernelize.cpp
+ * @brief Tests of the kernelization of the graphs
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <algorithm>
+
+#include "../src/algorithm/mewc.hpp"
+#include "test.hpp"
+
+/**
+ * @brief Get the heaviest clique of a small graph by brute force
+ *
+ * @param graph The graph
+ * @return long unsigned int The weight of the heaviest clique
+ */
+static long unsigned int bruteForceOptimum(const Graph &graph)
+{
+    long unsigned int optimum = 0;
+    for (const auto &clique : bruteForceCliques(FrozenGraph(graph)))
+        optimum = std::max(optimum, clique.weight);
+    return optimum;
+}
+
+TEST(kernelizeKeepsTheOptimum)
+{
+    std::mt19937 random(23);
+    for (unsigned int round = 0; round < 150; round++)
+    {
+        unsigned int n = 1 + round % 16;
+        Graph graph = randomGraph(n, (round % 5 + 1) / 6.0, 1 + round % 25, random);
+        long unsigned int optimum = bruteForceOptimum(graph);
+        Clique heuristic = constructiveMEWC(graph);
+        long unsigned int heuristic_weight = heuristic.weight(graph);
+
+        for (long unsigned int lower_bound : {heuristic_weight, optimum, optimum / 2})
+        {
+            Graph kernel = graph;
+            KernelReport report = kernel.kernelize(lower_bound);
+            CHECK(kernel.size() == graph.size() - report.vertices);
+            CHECK(kernel.edges().size() == graph.edges().size() - report.edges);
+            CHECK(!kernel.empty());
+            CHECK(bruteForceOptimum(kernel) == optimum);
+        }
+
+        // The clique of the lower bound is kept
+        Graph kernel = graph;
+        kernel.kernelize(heuristic_weight);
+        CHECK(kernel.hasVertices(heuristic.ids()));
+        CHECK(heuristic.weight(kernel) == heuristic_weight);
+    }
+}
+
+TEST(kernelizeRemovesLightPendantEdges)
+{
+    // A triangle of weight 30 and a pendant edge of weight 5 to vertex 4
+    Graph graph;
+    for (unsigned int id = 1; id <= 4; id++)
+        graph.addVertex(id);
+    graph.addEdge(1, 2, 10);
+    graph.addEdge(2, 3, 10);
+    graph.addEdge(1, 3, 10);
+    graph.addEdge(3, 4, 5);
+
+    KernelReport report = graph.kernelize(30);
+    CHECK(report.vertices == 1);
+    CHECK(report.edges == 1);
+    CHECK(!graph.hasVertex(4));
+    CHECK(graph.hasVertices(1, 4));
+}
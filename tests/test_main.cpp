@@ -0,0 +1,149 @@
+/**
+ * @file test_main.cpp
+ * @brief Test runner and helpers shared by the tests
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <iostream>
+#include <utility>
+
+#include "test.hpp"
+
+/**
+ * @brief Get the registered tests
+ *
+ * The list is a static local so that it is built before the tests of the other
+ * translation units register themselves.
+ *
+ * @return std::vector<std::pair<std::string, TestFunction>>& The name and the
+ * function of each test
+ */
+static std::vector<std::pair<std::string, TestFunction>> &tests()
+{
+    static std::vector<std::pair<std::string, TestFunction>> tests;
+    return tests;
+}
+
+/**
+ * @brief Register a test to be run by the test runner
+ *
+ * @param name The name of the test
+ * @param test The function of the test
+ * @return int The number of tests registered so far
+ */
+int registerTest(const char *name, TestFunction test)
+{
+    tests().emplace_back(name, test);
+    return tests().size();
+}
+
+/**
+ * @brief Fail the running test
+ *
+ * @param file The file of the failed check
+ * @param line The line of the failed check
+ * @param message The failed check
+ * @throws TestFailure Always
+ */
+void fail(const char *file, int line, const std::string &message)
+{
+    throw TestFailure(std::string(file) + ":" + std::to_string(line) + ": " + message);
+}
+
+/**
+ * @brief Generate a random graph
+ *
+ * The vertices have the ids 1 to vertices, like the graphs read from a file,
+ * and each pair of vertices is joined with probability density by an edge of
+ * weight 1 to max_weight.
+ *
+ * @param vertices The number of vertices
+ * @param density The probability of each edge
+ * @param max_weight The highest weight of an edge
+ * @param random The random number generator
+ * @return Graph The graph
+ */
+Graph randomGraph(unsigned int vertices, double density, unsigned int max_weight, std::mt19937 &random)
+{
+    std::bernoulli_distribution edge(density);
+    std::uniform_int_distribution<unsigned int> weight(1, max_weight);
+
+    Graph graph;
+    for (unsigned int id = 1; id <= vertices; id++)
+        graph.addVertex(id);
+    for (unsigned int u = 1; u <= vertices; u++)
+        for (unsigned int v = u + 1; v <= vertices; v++)
+            if (edge(random))
+                graph.addEdge(u, v, weight(random));
+    return graph;
+}
+
+/**
+ * @brief Find all the cliques of a small frozen graph by trying every subset
+ * of its vertices
+ *
+ * @param graph The frozen graph, with at most 20 vertices
+ * @return std::vector<BruteForceClique> The non-empty cliques
+ */
+std::vector<BruteForceClique> bruteForceCliques(const FrozenGraph &graph) // O(2^n * n^2)
+{
+    unsigned int n = graph.size();
+    auto isClique = [&graph, n](long unsigned int subset)
+    {
+        for (unsigned int u = 0; u < n; u++)
+            for (unsigned int v = u + 1; v < n; v++)
+                if ((subset >> u & 1) && (subset >> v & 1) && !graph.hasEdge(u, v))
+                    return false;
+        return true;
+    };
+
+    std::vector<BruteForceClique> cliques;
+    for (long unsigned int subset = 1; subset < 1ul << n; subset++)
+    {
+        if (!isClique(subset))
+            continue;
+
+        BruteForceClique clique;
+        for (unsigned int v = 0; v < n; v++)
+            if (subset >> v & 1)
+                clique.vertices.push_back(v);
+        clique.weight = graph.weight(clique.vertices);
+        clique.maximal = true;
+        for (unsigned int v = 0; v < n && clique.maximal; v++)
+            if (!(subset >> v & 1) && isClique(subset | 1ul << v))
+                clique.maximal = false;
+        cliques.push_back(clique);
+    }
+    return cliques;
+}
+
+/**
+ * @brief Run the tests whose name contains the first argument, or all of them
+ *
+ * @return int 0 if all the tests passed, 1 otherwise
+ */
+int main(int argc, char *argv[])
+{
+    std::string filter = argc > 1 ? argv[1] : "";
+    unsigned int passed = 0, failed = 0;
+    for (const auto &[name, test] : tests())
+    {
+        if (name.find(filter) == std::string::npos)
+            continue;
+        try
+        {
+            test();
+            passed++;
+            std::cout << "[ OK ] " << name << std::endl;
+        }
+        catch (const std::exception &e)
+        {
+            failed++;
+            std::cout << "[FAIL] " << name << ": " << e.what() << std::endl;
+        }
+    }
+    std::cout << passed << " passed, " << failed << " failed" << std::endl;
+    return failed == 0 ? 0 : 1;
+}
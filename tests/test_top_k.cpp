@@ -0,0 +1,61 @@
+/**
+ * @file test_top_k.cpp
+ * @brief Tests of the search of the k heaviest maximal cliques
+ * @authors
+ * - agent <agent@local>
+ * @date 2026-10-17
+ */
+
+#include <algorithm>
+#include <functional>
+#include <set>
+
+#include "../src/algorithm/mewc.hpp"
+#include "test.hpp"
+
+TEST(topKMatchesBruteForce)
+{
+    std::mt19937 random(17);
+    for (unsigned int round = 0; round < 100; round++)
+    {
+        unsigned int n = 2 + round % 13;
+        FrozenGraph graph(randomGraph(n, (round % 4 + 1) / 5.0, 1 + round % 20, random));
+
+        std::set<std::vector<unsigned int>> maximal;
+        std::vector<long unsigned int> weights;
+        for (const auto &clique : bruteForceCliques(graph))
+            if (clique.maximal)
+            {
+                maximal.insert(clique.vertices);
+                weights.push_back(clique.weight);
+            }
+        std::sort(weights.begin(), weights.end(), std::greater<long unsigned int>());
+
+        for (unsigned int k : {1u, 2u, 5u, 1000u})
+        {
+            std::vector<Clique> cliques = topKMEWC(graph, k);
+            CHECK(cliques.size() == std::min<long unsigned int>(k, weights.size()));
+
+            std::set<std::vector<unsigned int>> found;
+            for (long unsigned int i = 0; i < cliques.size(); i++)
+            {
+                std::vector<unsigned int> indices = graph.indices(cliques[i]);
+                std::sort(indices.begin(), indices.end());
+
+                // Distinct maximal cliques, with the weights of the k heaviest
+                CHECK(maximal.count(indices) == 1);
+                CHECK(found.insert(indices).second);
+                CHECK(graph.weight(indices) == weights[i]);
+            }
+        }
+    }
+}
+
+TEST(topKOfACompleteGraphIsTheGraph)
+{
+    std::mt19937 random(19);
+    FrozenGraph graph(randomGraph(8, 1, 9, random));
+    std::vector<Clique> cliques = topKMEWC(graph, 3);
+    CHECK(cliques.size() == 1);
+    CHECK(cliques.front().size() == 8);
+}